@@ -0,0 +1,424 @@
+// mediflow_bench - micro-benchmarks for the core containers
+//
+// Usage: mediflow_bench [--min=N] [--max=N] [--seed=N] [--json[=FILE]] [--stats]
+//        mediflow_bench --concurrent [--threads=N] [--seed=N] [--json[=FILE]]
+//
+// For each size (powers of ten from --min to --max, default 1e3..1e6) it
+// times the record list (insert, search by ID / name, both sorts, CSV and
+// snapshot save/load, the checkpoint copy archiveTo, delete) and the triage
+// queue (enqueue, archiveTo, dequeue).
+// sortByName(seq) and (par) force each sort path on the same input.
+// query(indexed) and query(scan) answer the same selective multi-criteria
+// queries through the secondary indexes and by walking the list;
+// admittedBetween and mostRecentAdmissions time the admission-date index.
+// Everything runs in memory plus two scratch files in the current
+// directory; no network, no journal. Results are ns/op, ops/s and the
+// process peak RSS after each run, as a table or as JSON. --stats turns on
+// the Stats instrumentation, to measure its cost.
+//
+// --concurrent instead measures ConcurrentTriageQueue enqueue+dequeue
+// throughput at 1, 2, 4, ... --threads (default 32) threads against
+// QueueADT behind a mutex. The n column is the thread count. Its
+// correctness under contention is checked by mediflow_triage_test.
+
+#include "../include/ConcurrentTriageQueue.h"
+#include "../include/LinkedListADT.h"
+#include "../include/PatientQuery.h"
+#include "../include/QueueADT.h"
+#include "../include/Stats.h"
+#include "../include/Utils.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+static const char* const SCRATCH_CSV = "mediflow_bench.tmp.txt";
+static const char* const SCRATCH_SNAP = "mediflow_bench.tmp.snap";
+static const int QUERY_COUNT = 60;     // Queries per query benchmark (ops column)
+
+struct Result {
+    string name;
+    long long size;         // Records in the container
+    long long ops;          // Operations timed (records touched, for sorts and file I/O)
+    double seconds;
+    long long peakRssKb;
+};
+
+// Process high-water mark in KiB (monotonic, so it reflects the largest run so far)
+static long long peakRssKb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<long long>(usage.ru_maxrss / 1024);     // Bytes on macOS
+#else
+    return static_cast<long long>(usage.ru_maxrss);            // KiB on Linux
+#endif
+#endif
+}
+
+// Deterministic synthetic records: random names, shuffled insertion order
+static vector<Patient> makePatients(long long n, mt19937_64& rng) {
+    static const char* const FIRST[] = {
+        "Ahmad", "Aisha", "Ali", "Amir", "Chen", "Daniel", "Fatimah", "Hana", "Ivan", "Jia",
+        "Kumar", "Lee", "Maria", "Mei", "Nur", "Omar", "Priya", "Raj", "Sara", "Wei"
+    };
+    static const char* const LAST[] = {
+        "Abdullah", "Bakar", "Chong", "Das", "Fernandez", "Goh", "Hassan", "Ibrahim", "Lim", "Menon",
+        "Ng", "Ong", "Rahman", "Singh", "Tan", "Teo", "Wong", "Yusof", "Zain", "Zulkifli"
+    };
+    static const char* const CONDITIONS[] = {
+        "Fever", "Fracture", "Chest Pain", "Asthma", "Migraine", "Laceration", "Checkup", "Flu"
+    };
+
+    vector<Patient> patients;
+    patients.reserve(static_cast<size_t>(n));
+    char buffer[24];
+    for (long long i = 0; i < n; i++) {
+        snprintf(buffer, sizeof(buffer), "P%07lld", i + 1);
+        string name = string(FIRST[rng() % 20]) + " " + LAST[rng() % 20] + " " + to_string(rng() % 1000);
+        char date[11];
+        snprintf(date, sizeof(date), "2025-%02d-%02d", static_cast<int>(rng() % 12) + 1,
+                 static_cast<int>(rng() % 28) + 1);
+        patients.emplace_back(buffer, move(name), static_cast<int>(rng() % 100),
+                              CONDITIONS[rng() % 8], static_cast<int>(rng() % 3) + 1, date);
+    }
+    shuffle(patients.begin(), patients.end(), rng);
+    return patients;
+}
+
+class Bench {
+private:
+    vector<Result> results;
+
+public:
+    // Times body(); ops is how many operations it performed
+    void run(const string& name, long long size, long long ops, const function<void()>& body) {
+        auto start = chrono::steady_clock::now();
+        body();
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        results.push_back({name, size, ops, elapsed.count(), peakRssKb()});
+    }
+
+    void printTable(ostream& out) const {
+        char line[160];
+        snprintf(line, sizeof(line), "%-20s %10s %10s %12s %14s %12s\n",
+                 "benchmark", "n", "ops", "ns/op", "ops/s", "peak RSS KiB");
+        out << line << string(83, '-') << "\n";
+        for (const Result& r : results) {
+            double seconds = r.seconds > 0 ? r.seconds : 1e-9;
+            snprintf(line, sizeof(line), "%-20s %10lld %10lld %12.1f %14.0f %12lld\n",
+                     r.name.c_str(), r.size, r.ops, seconds * 1e9 / r.ops, r.ops / seconds,
+                     r.peakRssKb);
+            out << line;
+        }
+    }
+
+    void printJson(ostream& out) const {
+        char line[256];
+        out << "{\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            double seconds = r.seconds > 0 ? r.seconds : 1e-9;
+            snprintf(line, sizeof(line),
+                     "    {\"name\": \"%s\", \"n\": %lld, \"ops\": %lld, \"seconds\": %.9f, "
+                     "\"ns_per_op\": %.3f, \"ops_per_sec\": %.1f, \"peak_rss_kb\": %lld}%s\n",
+                     r.name.c_str(), r.size, r.ops, r.seconds, seconds * 1e9 / r.ops,
+                     r.ops / seconds, r.peakRssKb, (i + 1 < results.size()) ? "," : "");
+            out << line;
+        }
+        out << "  ]\n}\n";
+    }
+};
+
+static void benchSize(Bench& bench, long long n, mt19937_64& rng) {
+    vector<Patient> patients = makePatients(n, rng);
+
+    // Lookup keys in a different order from insertion
+    vector<size_t> order(patients.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    shuffle(order.begin(), order.end(), rng);
+
+    volatile size_t sink = 0;   // Keeps lookups from being optimised away
+    LinkedListADT list;
+
+    bench.run("insertPatient", n, n, [&] {
+        for (const Patient& p : patients) list.insertPatient(p);
+    });
+    bench.run("searchByID", n, n, [&] {
+        size_t found = 0;
+        for (size_t i : order) found += (list.searchByID(patients[i].id) != nullptr);
+        sink = sink + found;
+    });
+    bench.run("searchByName", n, n, [&] {
+        size_t found = 0;
+        for (size_t i : order) found += (list.searchByName(patients[i].name) != nullptr);
+        sink = sink + found;
+    });
+    bench.run("sortByName", n, n, [&] { list.sortByName(); });
+    bench.run("sortByPriority", n, n, [&] { list.sortByPriority(); });
+
+    // Both sort paths forced, on the same shuffled input
+    for (int parallel = 0; parallel < 2; parallel++) {
+        LinkedListADT copy;
+        copy.setParallelSort(parallel ? 0 : INT_MAX);
+        for (const Patient& p : patients) copy.insertPatient(p);
+        bench.run(parallel ? "sortByName(par)" : "sortByName(seq)", n, n, [&] { copy.sortByName(); });
+    }
+
+    // Selective multi-criteria queries through the indexes, then as a plain
+    // walk over the list (admission days parsed up front, so only the
+    // predicate checks are timed)
+    vector<PatientQuery> queries(QUERY_COUNT);
+    for (int i = 0; i < QUERY_COUNT; i++) {
+        PatientQuery& q = queries[static_cast<size_t>(i)];
+        int day = 0;
+        Utils::parseDate("2025-01-01", day);
+        switch (i % 3) {
+            case 0: q.minAge = static_cast<int>(rng() % 95); q.maxAge = q.minAge + 4; break;
+            case 1: q.fromDay = day + static_cast<int>(rng() % 330); q.toDay = q.fromDay + 6; break;
+            default: q.minAge = 85; q.priorities = 1; q.conditionText = "chest"; break;
+        }
+        if (i % 2 == 0) q.priorities |= 2;
+    }
+    vector<pair<Node*, int>> scanRows;
+    for (Node* node = list.getHead(); node != nullptr; node = node->next) {
+        int day;
+        scanRows.emplace_back(node, Utils::parseDate(node->data.admissionDate, day) ? day : INT_MIN);
+    }
+    bench.run("query(indexed)", n, QUERY_COUNT, [&] {
+        size_t found = 0;
+        for (const PatientQuery& q : queries) found += list.query(q).size();
+        sink = sink + found;
+    });
+    bench.run("query(scan)", n, QUERY_COUNT, [&] {
+        size_t found = 0;
+        for (const PatientQuery& q : queries) {
+            vector<Node*> results;
+            for (const auto& row : scanRows) {
+                if (q.matches(row.first->data, row.second)) results.push_back(row.first);
+            }
+            found += results.size();
+        }
+        sink = sink + found;
+    });
+
+    // Admission-date index: one week each, then the latest 100
+    int firstDay = 0;
+    Utils::parseDate("2025-01-01", firstDay);
+    bench.run("admittedBetween(7d)", n, QUERY_COUNT, [&] {
+        size_t found = 0;
+        for (int i = 0; i < QUERY_COUNT; i++) {
+            int from = firstDay + (i * 5) % 330;
+            found += list.admittedBetween(from, from + 6).size();
+        }
+        sink = sink + found;
+    });
+    bench.run("mostRecentAdmissions", n, QUERY_COUNT, [&] {
+        size_t found = 0;
+        for (int i = 0; i < QUERY_COUNT; i++) found += list.mostRecentAdmissions(100).size();
+        sink = sink + found;
+    });
+
+    // The copy a background checkpoint takes on the UI thread
+    bench.run("archiveTo", n, n, [&] {
+        CompactPatientStore store;
+        list.archiveTo(store);
+        sink = sink + store.size();
+    });
+    bench.run("saveToFile(csv)", n, n, [&] { list.saveToFile(SCRATCH_CSV); });
+    bench.run("saveToFile(snap)", n, n, [&] { list.saveToFile(SCRATCH_SNAP); });
+    {
+        LinkedListADT loaded;
+        bench.run("loadFromFile(csv)", n, n, [&] { loaded.loadFromFile(SCRATCH_CSV); });
+    }
+    {
+        LinkedListADT loaded;
+        bench.run("loadFromFile(snap)", n, n, [&] { loaded.loadFromFile(SCRATCH_SNAP); });
+    }
+    remove(SCRATCH_CSV);
+    remove(SCRATCH_SNAP);
+
+    bench.run("deletePatient", n, n, [&] {
+        for (size_t i : order) list.deletePatient(patients[i].id);
+    });
+
+    QueueADT queue;
+    bench.run("enqueue", n, n, [&] {
+        for (const Patient& p : patients) queue.enqueue(p);
+    });
+    bench.run("archiveTo(queue)", n, n, [&] {
+        CompactPatientStore store;
+        queue.archiveTo(store);
+        sink = sink + store.size();
+    });
+    bench.run("dequeue", n, n, [&] {
+        size_t total = 0;
+        while (!queue.isEmpty()) total += queue.dequeue().id.size();
+        sink = sink + total;
+    });
+}
+
+// ============= CONCURRENT TRIAGE QUEUE =============
+
+// Runs body(0..threads-1) on its own threads and waits for all of them
+static void runThreads(int threads, const function<void(int)>& body) {
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) pool.emplace_back(body, t);
+    for (thread& worker : pool) worker.join();
+}
+
+// Every thread enqueues one patient then serves one, PAIRS / threads times
+static void benchConcurrent(Bench& bench, int threads, mt19937_64& rng) {
+    const long long PAIRS = 1 << 18;
+    long long perThread = PAIRS / threads;
+    long long ops = 2 * perThread * threads;
+
+    vector<vector<Patient>> work(static_cast<size_t>(threads));
+    vector<Patient> pool = makePatients(perThread * threads, rng);
+    for (long long i = 0; i < perThread * threads; i++) {
+        work[static_cast<size_t>(i % threads)].push_back(pool[static_cast<size_t>(i)]);
+    }
+    vector<vector<Patient>> lockedWork = work;
+    atomic<size_t> sink(0);
+
+    ConcurrentTriageQueue queue;
+    bench.run("mpmc enq+deq", threads, ops, [&] {
+        runThreads(threads, [&](int t) {
+            size_t total = 0;
+            Patient p;
+            for (Patient& arrival : work[static_cast<size_t>(t)]) {
+                queue.enqueue(std::move(arrival));
+                while (!queue.tryDequeue(p)) this_thread::yield();
+                total += p.id.size();
+            }
+            sink += total;
+        });
+    });
+
+    // Baseline: the single-threaded queue with one global lock
+    QueueADT locked;
+    mutex queueMutex;
+    bench.run("locked enq+deq", threads, ops, [&] {
+        runThreads(threads, [&](int t) {
+            size_t total = 0;
+            for (Patient& arrival : lockedWork[static_cast<size_t>(t)]) {
+                {
+                    lock_guard<mutex> lock(queueMutex);
+                    locked.enqueue(std::move(arrival));
+                }
+                while (true) {
+                    {
+                        lock_guard<mutex> lock(queueMutex);
+                        if (!locked.isEmpty()) {
+                            total += locked.dequeue().id.size();
+                            break;
+                        }
+                    }
+                    this_thread::yield();   // Don't starve the thread that would refill it
+                }
+            }
+            sink += total;
+        });
+    });
+}
+
+static bool parseCount(const string& arg, const string& prefix, long long& value) {
+    if (arg.compare(0, prefix.size(), prefix) != 0) return false;
+    value = static_cast<long long>(strtod(arg.c_str() + prefix.size(), nullptr));   // Accepts 1e6
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    long long minSize = 1000, maxSize = 1000000, seed = 42, maxThreads = 32;
+    bool json = false;
+    bool concurrent = false;
+    string jsonFile;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (parseCount(arg, "--min=", minSize) || parseCount(arg, "--max=", maxSize) ||
+            parseCount(arg, "--seed=", seed) || parseCount(arg, "--threads=", maxThreads)) {
+            continue;
+        }
+        if (arg == "--json") {
+            json = true;
+        } else if (arg == "--stats") {
+            Stats::setEnabled(true);
+        } else if (arg == "--concurrent") {
+            concurrent = true;
+        } else if (arg.compare(0, 7, "--json=") == 0) {
+            json = true;
+            jsonFile = arg.substr(7);
+        } else {
+            cerr << "Usage: " << argv[0] << " [--min=N] [--max=N] [--seed=N] [--json[=FILE]] [--stats]\n"
+                 << "       " << argv[0] << " --concurrent [--threads=N] [--seed=N] [--json[=FILE]]\n";
+            return 1;
+        }
+    }
+    if (minSize < 1 || maxSize < minSize || maxThreads < 1) {
+        cerr << "[ERROR] Need 1 <= --min <= --max and --threads >= 1.\n";
+        return 1;
+    }
+
+    mt19937_64 rng(static_cast<unsigned long long>(seed));
+    Bench bench;
+    if (concurrent) {
+        for (long long threads = 1; threads <= maxThreads; threads *= 2) {
+            cerr << "[INFO] Running " << threads << " threads...\n";
+            cout.setstate(ios::badbit);
+            benchConcurrent(bench, static_cast<int>(threads), rng);
+            cout.clear();
+        }
+    }
+    for (long long n = minSize; !concurrent && n <= maxSize; n *= 10) {
+        cerr << "[INFO] Running n=" << n << "...\n";
+        // The containers report to cout; a failed stream turns that into no-ops
+        cout.setstate(ios::badbit);
+        benchSize(bench, n, rng);
+        cout.clear();
+    }
+
+    if (!json) {
+        bench.printTable(cout);
+    } else if (jsonFile.empty()) {
+        bench.printJson(cout);
+    } else {
+        ofstream file(jsonFile);
+        bench.printJson(file);
+        if (!file) {
+            cerr << "[ERROR] Cannot write " << jsonFile << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
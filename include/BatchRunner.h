@@ -0,0 +1,70 @@
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include "LinkedListADT.h"
+#include "QueueADT.h"
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+
+// Non-interactive command interpreter for scripted, high-volume work
+//
+// One command per line; blank lines and lines starting with '#' are skipped.
+// Patient fields use the same order as patients.txt:
+//   ADD      id,name,age,condition,priority,date
+//   UPDATE   id,name,age,condition,priority,date     (replaces record id)
+//   DELETE   id
+//   SEARCH   id
+//   FIND     name prefix
+//   QUERY    key=value,...                           (age=N-M, priority=12, from=/to=YYYY-MM-DD,
+//                                                     condition=text, limit=N; see PatientQuery.h)
+//   ADMITTED from,to[,limit]                         (YYYY-MM-DD dates, inclusive, oldest first)
+//   RECENT   n                                       (latest admissions, newest first)
+//   DAILY    from,to                                 (admissions per day that had any)
+//   SORT     NAME | PRIORITY | TRIAGE                 (TRIAGE = priority, date, name)
+//   ENQUEUE  id                                      (copy of the stored record)
+//   ENQUEUE  id,name,age,condition,priority,date     (walk-in)
+//   DEQUEUE
+//   RETRIAGE id,priority
+//   REMOVE   id
+//   WAITING  id                                      (the queued copy, if waiting)
+//   LIST     page[,size]                             (record list, default 20 per page)
+//   QUEUE    page[,size]                             (waiting list in service order)
+//   COUNT
+//   SAVE
+//
+// New records (ADD, UPDATE, walk-in ENQUEUE) need a valid YYYY-MM-DD date.
+// Every command produces one tab-separated result line:
+//   OK<TAB>COMMAND[<TAB>detail...]      or      ERR<TAB>COMMAND<TAB>message
+// Records in results are printed as patients.txt lines. LIST and QUEUE
+// answer "page<TAB>pages<TAB>total" followed by one field per record;
+// DAILY answers the total, then one "YYYY-MM-DD,count" field per day.
+class BatchRunner {
+private:
+    LinkedListADT& patientList;
+    QueueADT& queue;
+    std::function<bool()> saveHandler;
+
+public:
+    BatchRunner(LinkedListADT& patientList, QueueADT& queue);
+
+    // SAVE calls this (writes the data files); without one SAVE fails
+    void setSaveHandler(const std::function<bool()>& handler) { saveHandler = handler; }
+
+    // Runs one command and appends its result line (with '\n') to result.
+    // Returns false if the command failed.
+    bool execute(const std::string& line, std::string& result);
+
+    // True for commands that only read the containers (safe to run
+    // concurrently with each other, never with anything else)
+    static bool isReadOnly(const std::string& command);
+
+    // Runs every line of in. Each result line is prefixed with the input
+    // line number and a tab; output is buffered and ends with
+    // "DONE<TAB>ok=N<TAB>err=M". Console messages from the containers are
+    // suppressed while it runs. Returns the number of failed commands.
+    long long run(std::istream& in, std::ostream& out);
+};
+
+#endif
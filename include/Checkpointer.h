@@ -0,0 +1,74 @@
+#ifndef CHECKPOINTER_H
+#define CHECKPOINTER_H
+
+#include "LinkedListADT.h"
+#include "QueueADT.h"
+#include "Journal.h"
+#include "CompactPatient.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Background checkpointing of the patient records and queue files
+//
+// The UI thread calls poll() after every menu action. Once enough journal
+// records have built up, or the interval has passed with changes pending,
+// it copies both containers into compact stores stamped with the current
+// journal LSN (a memory-only pass, no disk I/O), rotates the journal and
+// hands the copies to a worker thread. The worker writes both files
+// (temp file + rename); the retired journal segment is discarded on the
+// next poll() once the write has succeeded.
+//
+// The copy is O(n) and blocks the UI thread for its duration: roughly
+// 0.3 us per list record and 0.2 us per queued patient (mediflow_bench
+// archiveTo rows), so about half a second at a million of each. Only the
+// disk write is moved off the UI thread.
+class Checkpointer {
+private:
+    struct Job {
+        CompactPatientStore records;
+        CompactPatientStore queue;
+        uint64_t lsn;
+
+        Job() : lsn(0) {}
+    };
+
+    Journal& journal;
+    std::string patientsFile;
+    std::string queueFile;
+    int intervalSeconds;            // Checkpoint pending changes at least this often...
+    long long recordThreshold;      // ...or as soon as this many records are journaled
+
+    std::thread worker;
+    std::mutex stateMutex;
+    std::condition_variable wake;
+    Job job;                        // Handed to the worker while busy
+    bool busy;                      // Job in flight or result not yet collected
+    bool finished;                  // Worker is done with the current job
+    bool succeeded;
+    bool stopping;
+    std::chrono::steady_clock::time_point lastCheckpoint;
+
+    void run();                     // Worker thread body
+    void collect();                 // UI thread: pick up a finished job
+
+public:
+    explicit Checkpointer(Journal& journal);
+    ~Checkpointer();
+
+    Checkpointer(const Checkpointer&) = delete;
+    Checkpointer& operator=(const Checkpointer&) = delete;
+
+    void configure(int intervalSeconds, long long recordThreshold);
+    void start(const std::string& patientsFile, const std::string& queueFile);
+    void stop();                    // Waits for a write in progress
+
+    // Called by the UI thread between actions; never waits on disk, but
+    // copies both containers when a checkpoint is due
+    void poll(const LinkedListADT& patientList, const QueueADT& queue);
+};
+
+#endif
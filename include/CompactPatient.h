@@ -0,0 +1,86 @@
+#ifndef COMPACTPATIENT_H
+#define COMPACTPATIENT_H
+
+#include "Patient.h"
+#include "HashIndex.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Interns repeated strings (conditions such as "Fever", "Fracture")
+// so each distinct value is stored once and referenced by a 32-bit ID.
+class StringPool {
+private:
+    std::vector<std::string> values;
+    HashIndex<uint32_t> lookup;
+
+public:
+    uint32_t intern(const std::string& value);
+    const std::string& get(uint32_t id) const { return values[id]; }
+    uint32_t size() const { return static_cast<uint32_t>(values.size()); }
+    void clear();
+};
+
+// Fixed 32-byte patient record for the compact format
+// - IDs up to 11 chars are stored inline (small-string layout); longer
+//   IDs spill into the name arena
+// - Names live in a shared character arena (offset + length)
+// - Conditions are interned StringPool IDs
+// - Admission dates are day numbers; text that is not YYYY-MM-DD is kept
+//   verbatim in the pool so nothing is lost
+// - Ages or priorities that do not fit their fields are flagged and kept
+//   exactly as two int32s right after the name in the arena
+struct CompactPatient {
+    static const uint8_t FLAG_LONG_ID = 1;       // id holds arena offset/length
+    static const uint8_t FLAG_RAW_DATE = 2;      // admissionDay holds a pool ID
+    static const uint8_t FLAG_WIDE_NUMBERS = 4;  // age/priority follow the name in the arena
+
+    char id[11];
+    uint8_t idLength;
+    uint16_t age;
+    int8_t priority;
+    uint8_t flags;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t conditionId;
+    int32_t admissionDay;      // Days since 1970-01-01 (see Utils::parseDate)
+};
+
+static_assert(sizeof(CompactPatient) == 32, "CompactPatient must stay 32 bytes");
+
+// Append-only compact copy of a set of patient records. A record costs
+// 32 bytes plus its name characters, versus well over 150 bytes for a
+// Patient inside a list Node. Records are expanded back to Patient on read.
+// This is the in-memory form behind binary snapshots, CSV writes and the
+// background checkpoint copy; the live containers still hold full Nodes,
+// so it does not shrink LinkedListADT or QueueADT themselves.
+class CompactPatientStore {
+private:
+    std::vector<CompactPatient> records;
+    std::string arena;          // Name (and long ID) characters
+    StringPool strings;         // Conditions and non-standard date text
+
+public:
+    void append(const Patient& p);
+    Patient get(size_t index) const;
+
+    // Field accessors that avoid building a whole Patient
+    std::string idAt(size_t index) const;
+    std::string nameAt(size_t index) const;
+    const std::string& conditionAt(size_t index) const;
+    std::string admissionDateAt(size_t index) const;
+    int ageAt(size_t index) const;
+    int priorityAt(size_t index) const;
+
+    size_t size() const { return records.size(); }
+    void reserve(size_t recordCount);
+    void clear();
+    size_t memoryUsage() const;   // Approximate bytes held
+
+    // Raw parts, for writers that serialize the store directly
+    const std::vector<CompactPatient>& rawRecords() const { return records; }
+    const std::string& rawArena() const { return arena; }
+    const StringPool& rawStrings() const { return strings; }
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef CONCURRENTTRIAGEQUEUE_H
+#define CONCURRENTTRIAGEQUEUE_H
+
+#include "MpmcRing.h"
+#include "Patient.h"
+#include <cstddef>
+
+// Triage queue for many nurses enqueuing and many doctors serving at once
+//
+// One lock-free MPMC ring per priority level. Enqueue goes straight to its
+// level's ring; dequeue takes from the most urgent non-empty ring. Each
+// patient is handed to exactly one caller, patients of the same priority
+// leave in arrival order, and a dequeue never skips a level that was
+// non-empty when it looked: if a producer has claimed the next slot of a
+// level but not filled it yet, the dequeue waits for it. There are no
+// locks, but a producer or consumer descheduled mid-operation can hold up
+// the threads that need its slot.
+//
+// Compared to QueueADT it is bounded (per level), and it has no ID index,
+// re-triage, removal, journal or event log: it is the hand-off between
+// threads, not the system of record.
+class ConcurrentTriageQueue {
+private:
+    MpmcRing<Patient> critical;             // Priority 1
+    MpmcRing<Patient> urgent;               // Priority 2
+    MpmcRing<Patient> normal;               // Priority 3
+
+    MpmcRing<Patient>* ringFor(int priority);
+
+public:
+    static const size_t DEFAULT_CAPACITY = 4096;    // Per priority level
+
+    explicit ConcurrentTriageQueue(size_t capacityPerLevel = DEFAULT_CAPACITY);
+
+    ConcurrentTriageQueue(const ConcurrentTriageQueue&) = delete;
+    ConcurrentTriageQueue& operator=(const ConcurrentTriageQueue&) = delete;
+
+    // False if the priority is not 1-3 or that level is full
+    bool enqueue(Patient patient);
+
+    // Most urgent patient into out; false if every level was empty
+    bool tryDequeue(Patient& out);
+
+    // Both are snapshots that may be stale under concurrent use
+    size_t approximateSize() const;
+    bool isEmpty() const { return approximateSize() == 0; }
+};
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Open-addressing hash table keyed by string (e.g. Patient::id -> Node*)
+// Linear probing with backward-shift deletion, so there are no tombstones
+// and lookups stay O(1) on average no matter how many deletes happen.
+template <typename Value>
+class HashIndex {
+private:
+    struct Slot {
+        std::string key;
+        Value value;
+        uint64_t hash;
+        bool used;
+
+        Slot() : value(), hash(0), used(false) {}
+    };
+
+    std::vector<Slot> slots;   // Capacity is always a power of two
+    size_t count;
+
+    static uint64_t hashKey(const std::string& key) {
+        // FNV-1a (64-bit)
+        uint64_t h = 1469598103934665603ULL;
+        for (unsigned char c : key) {
+            h ^= c;
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    size_t mask() const { return slots.size() - 1; }
+
+    // Returns the slot holding key, or the empty slot where it would go
+    size_t probe(const std::string& key, uint64_t h) const {
+        size_t i = h & mask();
+        while (slots[i].used) {
+            if (slots[i].hash == h && slots[i].key == key) {
+                return i;
+            }
+            i = (i + 1) & mask();
+        }
+        return i;
+    }
+
+    void rehash(size_t newCapacity) {
+        std::vector<Slot> old;
+        old.swap(slots);
+        slots.resize(newCapacity);
+        for (Slot& s : old) {
+            if (!s.used) continue;
+            size_t i = s.hash & mask();
+            while (slots[i].used) {
+                i = (i + 1) & mask();
+            }
+            slots[i] = std::move(s);
+        }
+    }
+
+    void growIfNeeded() {
+        // Keep load factor <= 0.7
+        if ((count + 1) * 10 > slots.size() * 7) {
+            rehash(slots.size() * 2);
+        }
+    }
+
+public:
+    explicit HashIndex(size_t initialCapacity = 16) : count(0) {
+        size_t cap = 16;
+        while (cap < initialCapacity) cap <<= 1;
+        slots.resize(cap);
+    }
+
+    // Returns false (and changes nothing) if the key already exists
+    bool insert(const std::string& key, const Value& value) {
+        growIfNeeded();
+        uint64_t h = hashKey(key);
+        size_t i = probe(key, h);
+        if (slots[i].used) {
+            return false;
+        }
+        slots[i].key = key;
+        slots[i].value = value;
+        slots[i].hash = h;
+        slots[i].used = true;
+        count++;
+        return true;
+    }
+
+    Value* find(const std::string& key) {
+        size_t i = probe(key, hashKey(key));
+        return slots[i].used ? &slots[i].value : nullptr;
+    }
+
+    const Value* find(const std::string& key) const {
+        size_t i = probe(key, hashKey(key));
+        return slots[i].used ? &slots[i].value : nullptr;
+    }
+
+    bool contains(const std::string& key) const {
+        return find(key) != nullptr;
+    }
+
+    bool erase(const std::string& key) {
+        size_t i = probe(key, hashKey(key));
+        if (!slots[i].used) {
+            return false;
+        }
+
+        // Backward-shift: pull later members of the probe run into the hole
+        size_t j = i;
+        while (true) {
+            j = (j + 1) & mask();
+            if (!slots[j].used) break;
+            size_t home = slots[j].hash & mask();
+            // Move j into the hole only if its home is not in (i, j]
+            bool homeInRange = (i <= j) ? (home > i && home <= j)
+                                        : (home > i || home <= j);
+            if (!homeInRange) {
+                slots[i] = std::move(slots[j]);
+                i = j;
+            }
+        }
+        slots[i] = Slot();
+        count--;
+        return true;
+    }
+
+    void clear() {
+        for (Slot& s : slots) {
+            s = Slot();
+        }
+        count = 0;
+    }
+
+    // Pre-size for n entries (used by bulk loaders)
+    void reserve(size_t n) {
+        size_t cap = slots.size();
+        while (n * 10 > cap * 7) cap <<= 1;
+        if (cap != slots.size()) {
+            rehash(cap);
+        }
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    // Visit every (key, value) pair in unspecified order
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (const Slot& s : slots) {
+            if (s.used) fn(s.key, s.value);
+        }
+    }
+};
+
+#endif
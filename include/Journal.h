@@ -0,0 +1,119 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include "Patient.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Append-only write-ahead journal for patient record and queue mutations
+//
+// Every insert/delete/update/sort and enqueue/dequeue/remove/re-triage
+// appends one compact binary record stamped with a log sequence number
+// (LSN). Records are buffered and flushed + fsynced together (group
+// commit). On startup the journal is replayed on top of the last
+// snapshot; binary snapshots store the LSN they cover, so only newer
+// records are applied. Checkpoints write fresh snapshots and then
+// truncate (or rotate away) the records they cover.
+//
+// File layout:  "MFJOURNL" | uint64 baseLsn | records...
+// Record:       uint32 payloadLength | uint8 op | uint64 lsn | payload | uint32 checksum
+class Journal {
+public:
+    enum Op : uint8_t {
+        LIST_INSERT = 1,     // patient
+        LIST_DELETE = 2,     // id
+        LIST_UPDATE = 3,     // id, patient
+        LIST_SORT = 4,       // value = sort key
+        LIST_ORDER = 5,      // ids in new list order (custom comparator sorts)
+        QUEUE_ENQUEUE = 6,   // patient
+        QUEUE_DEQUEUE = 7,   // id of the patient served
+        QUEUE_REMOVE = 8,    // id
+        QUEUE_RETRIAGE = 9   // id, value = new priority
+    };
+
+    struct Entry {
+        Op op;
+        uint64_t lsn;
+        std::string id;
+        Patient patient;
+        int value;
+        std::vector<std::string> ids;
+
+        Entry() : op(LIST_INSERT), lsn(0), value(0) {}
+    };
+
+    static bool isQueueOp(Op op) { return op >= QUEUE_ENQUEUE; }
+
+private:
+    FILE* file;
+    std::string path;
+    uint64_t lastLsn;               // LSN of the newest record (buffered or not)
+    std::string buffer;             // Encoded records awaiting group commit
+    int pendingRecords;
+    std::chrono::steady_clock::time_point firstPending;
+    long long recordsInFile;        // Since the last truncate/rotate
+    bool failed;                    // Last commit failed; its records are still buffered
+
+    int groupCommitRecords;         // Commit once this many records are buffered...
+    int groupCommitDelayMs;         // ...or the oldest buffered record is this old
+
+    void append(Op op, const std::string& payload);
+    bool writeHeader(FILE* out, uint64_t baseLsn);
+    bool startFreshSegment();       // Empty live file, LSNs continue from lastLsn
+    std::string retiredPath() const { return path + ".old"; }
+
+public:
+    Journal();
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    // Replays every intact record through onEntry, drops a torn tail left
+    // by a crash and leaves the journal open for appending. New LSNs start
+    // above minLsn (the newest snapshot) even if the journal file was lost.
+    // A file without a journal header is renamed to PATH.corrupt rather than
+    // overwritten. Returns the number of records replayed, or -1 on I/O failure.
+    long long open(const std::string& journalPath, const std::function<void(const Entry&)>& onEntry,
+                   uint64_t minLsn = 0);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+
+    void setGroupCommit(int records, int delayMs);
+
+    // Mutation records
+    void logInsert(const Patient& p);
+    void logDelete(const std::string& id);
+    void logUpdate(const std::string& id, const Patient& p);
+    void logSort(int sortKey);
+    void logOrder(const std::vector<std::string>& ids);
+    void logEnqueue(const Patient& p);
+    void logDequeue(const std::string& id);
+    void logRemove(const std::string& id);
+    void logRetriage(const std::string& id, int newPriority);
+
+    // Write buffered records and fsync. On failure the records stay
+    // buffered (and are retried by the next commit), the error is reported
+    // once, and false is returned.
+    bool commit();
+    bool hasFailed() const { return failed; }
+
+    // After the caller has written snapshots covering lastLsn(): start an
+    // empty journal whose LSNs continue from there
+    bool truncate();
+
+    // For checkpoints written in the background: retire the current records
+    // to a side file (still replayed on startup) and continue in a fresh
+    // segment, then discard the retired one once the snapshots are on disk
+    bool rotate();
+    void discardRotated();
+
+    uint64_t getLastLsn() const { return lastLsn; }
+    long long getRecordsInFile() const { return recordsInFile; }
+};
+
+#endif
@@ -2,7 +2,20 @@
 #define LINKEDLISTADT_H
 
 #include "Patient.h"
+#include "HashIndex.h"
+#include "NodePool.h"
+#include "NameIndex.h"
+#include "QueryIndex.h"
+#include "CompactPatient.h"
+#include "Journal.h"
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <utility>
+#include <vector>
+
+// Strict "less than" ordering used by sortBy (must be a strict weak ordering)
+typedef std::function<bool(const Patient&, const Patient&)> PatientComparator;
 
 // Task Owner: Member 2
 // Doubly Linked List for permanent patient records
@@ -11,33 +24,116 @@ private:
     Node* head;
     Node* tail;
     int count;
+    NodePool pool;              // Slab storage for this container's nodes
+    HashIndex<Node*> idIndex;   // Patient::id -> Node*, O(1) average lookup
+    NameIndex nameIndex;        // Normalized name -> Node*, prefix lookup
+    QueryIndex queryIndex;      // Priority bitmaps, age and admission date indexes
+    Journal* journal;           // Mutation log (optional, not owned)
+    uint64_t snapshotLsn;       // Journal LSN covered by the loaded data file
+    int parallelSortThreshold;  // Lists at least this long sort on several threads
+    int sortThreads;            // 0 = one per hardware thread
+
+    // Natural merge sort helpers (relink nodes, never copy Patient data)
+    static Node* splitRun(Node* start, const PatientComparator& less);
+    static Node* mergeRuns(Node* a, Node* b, const PatientComparator& less, Node*& mergedTail);
+    void mergeSort(const PatientComparator& less);      // Picks the parallel path for long lists
+    void parallelSort(const PatientComparator& less);   // Sorts node pointers, relinks once
+    void reorder(const std::vector<std::string>& ids);  // Relink into a journaled order
+
+    bool linkNode(Node* newNode, bool verbose = true);  // Index + append, or discard a duplicate
 
 public:
+    // Built-in sort orders (recorded by key in the journal)
+    enum SortKey {
+        SORT_BY_NAME = 1,
+        SORT_BY_PRIORITY = 2
+    };
+
     LinkedListADT();
     ~LinkedListADT();
 
     // CRUD operations
-    void insertPatient(Patient p);              // Add new patient
+    bool insertPatient(const Patient& p);       // Add new patient (rejects duplicate IDs)
+    bool insertPatient(Patient&& p);
     bool deletePatient(const std::string& id);  // Remove by ID
-    bool updatePatient(const std::string& id, Patient newData);
+    bool updatePatient(const std::string& id, const Patient& newData);
+    bool updatePatient(const std::string& id, Patient&& newData);
+
+    // Construct the record directly inside a new node, e.g.
+    // emplacePatient(id, name, age, condition, priority, date)
+    template <typename... Args>
+    bool emplacePatient(Args&&... args) {
+        return linkNode(pool.create(std::in_place, std::forward<Args>(args)...));
+    }
 
     // Search & Sort (Task Owner: Member 3)
     Node* searchByID(const std::string& id) const;
-    Node* searchByName(const std::string& name) const;
-    void sortByName();                          // Sorting algorithm
+    Node* searchByName(const std::string& name) const;          // First exact match (case-insensitive)
+    std::vector<Node*> searchByNamePrefix(const std::string& prefix) const; // All matches, A-Z
+    void sortByName();                          // Stable merge sort, O(n log n)
     void sortByPriority();
+    void sortBy(const PatientComparator& less); // Any (multi-key) order, stable
+    static bool triageOrder(const Patient& a, const Patient& b);   // Priority, then date, then name
+
+    // Multi-criteria lookup (age range, priorities, admission dates, condition).
+    // The most selective index drives the walk; results are grouped by that
+    // index's key, up to q.limit. plan, if given, describes the index used.
+    std::vector<Node*> query(const PatientQuery& q, std::string* plan = nullptr) const;
+    size_t forEachMatch(const PatientQuery& q, const QueryIndex::Visitor& visit) const;  // No result vector
+
+    // Admission-date index (day numbers, see Utils::parseDate), O(log n + k).
+    // Records without a valid YYYY-MM-DD date are left out of all three.
+    std::vector<Node*> admittedBetween(int fromDay, int toDay, size_t limit = 0) const;   // Oldest first
+    std::vector<Node*> mostRecentAdmissions(size_t n) const;                              // Newest first
+    std::vector<std::pair<int, size_t>> dailyAdmissions(int fromDay, int toDay) const;    // (day, count)
+
+    // Lists of at least 'threshold' records are sorted by extracting the
+    // node pointers, sorting chunks on 'threads' threads (0 = hardware
+    // threads) and merging them pairwise in parallel. Both paths are stable,
+    // so the result is identical. Comparators passed to sortBy must then be
+    // safe to call from several threads at once.
+    static const int DEFAULT_PARALLEL_SORT_THRESHOLD = 100000;
+    void setParallelSort(int threshold, int threads = 0);
 
     // Display
     void displayAll() const;
     void displayReverse() const;                // Doubly linked feature
 
-    // File I/O
-    void saveToFile(const std::string& filename) const;
+    // Paged listing: every move costs O(page size), not O(n).
+    // A cursor is only valid until the list is next modified. pageSize must
+    // be at least 1: otherwise moves return the page unchanged (lastPage and
+    // jumpToPage the first page), pageRecords is empty and displayPage
+    // prints an error.
+    struct PageCursor {
+        Node* first;        // First record on the page (nullptr if the list is empty)
+        long long index;    // 0-based position of 'first', -1 if unknown (started from an ID)
+    };
+    PageCursor firstPage() const;
+    PageCursor lastPage(int pageSize) const;
+    PageCursor nextPage(const PageCursor& page, int pageSize) const;     // Same page if already last
+    PageCursor prevPage(const PageCursor& page, int pageSize) const;     // Follows prev pointers
+    PageCursor jumpToPage(long long pageNumber, int pageSize) const;     // 1-based; walks from the nearer end
+    bool pageFromID(const std::string& id, PageCursor& page) const;     // False if no such ID
+    void displayPage(const PageCursor& page, int pageSize) const;
+    std::vector<const Patient*> pageRecords(const PageCursor& page, int pageSize) const;
+
+    // File I/O (".snap"/".bin" = binary snapshot, anything else = CSV)
+    bool saveToFile(const std::string& filename) const;     // False (with a message) if not written
     void loadFromFile(const std::string& filename);
 
+    // Compact copy of every record (in list order), for snapshots and checkpoints
+    void archiveTo(CompactPatientStore& store) const;
+
     // Getters for integration
     Node* getHead() const { return head; }
     int getCount() const { return count; }
+    NodePool::Stats getPoolStats() const { return pool.getStats(); }
+
+    // Write-ahead journal: attach after loading; every successful mutation is
+    // then logged. applyJournalEntry replays a logged mutation quietly.
+    void setJournal(Journal* j) { journal = j; }
+    uint64_t getSnapshotLsn() const { return snapshotLsn; }
+    void applyJournalEntry(const Journal::Entry& entry);
 };
 
 #endif
\ No newline at end of file
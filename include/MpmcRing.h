@@ -0,0 +1,115 @@
+#ifndef MPMCRING_H
+#define MPMCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+// Bounded lock-free multi-producer/multi-consumer FIFO (Vyukov's ring)
+//
+// Every cell carries a sequence number that says whose turn it is: a
+// producer may fill cell i when its sequence equals the claim position,
+// a consumer may empty it when the sequence is one past that. Claims are
+// a single CAS on the shared head or tail, so each value is handed to
+// exactly one consumer, and values leave in the order their producers
+// claimed slots. Nothing allocates after construction. tryPop fails only
+// when the ring is empty, and otherwise waits out a producer that has
+// claimed the next slot but not finished moving its value in; tryPush
+// likewise fails only when the ring is full, and otherwise waits out a
+// consumer that has claimed the slot it needs but not finished moving the
+// value out.
+template <typename T>
+class MpmcRing {
+private:
+    static const size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;                                        // Capacity - 1 (capacity is a power of two)
+    // Own cache lines, so producers and consumers don't invalidate each other
+    alignas(CACHE_LINE) std::atomic<size_t> tail;       // Next slot to fill
+    alignas(CACHE_LINE) std::atomic<size_t> head;       // Next slot to empty
+
+public:
+    // Capacity is rounded up to a power of two (at least 2)
+    explicit MpmcRing(size_t capacity) : tail(0), head(0) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        cells.reset(new Cell[size]);
+        mask = size - 1;
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+
+    size_t capacity() const { return mask + 1; }
+
+    // False (value untouched) when full
+    bool tryPush(T&& value) {
+        size_t pos = tail.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t turn = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (turn == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (turn < 0) {
+                // Slot from the previous lap not released yet: full, or its consumer is mid-pop
+                intptr_t used = static_cast<intptr_t>(pos - head.load(std::memory_order_relaxed));
+                if (used >= static_cast<intptr_t>(capacity())) return false;
+                std::this_thread::yield();
+                pos = tail.load(std::memory_order_relaxed);
+            } else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // False (out untouched) when empty
+    bool tryPop(T& out) {
+        size_t pos = head.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t turn = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (turn == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (turn < 0) {
+                // Nothing published here yet: empty, or its producer is mid-push
+                intptr_t claimed = static_cast<intptr_t>(tail.load(std::memory_order_acquire) - pos);
+                if (claimed <= 0) return false;
+                std::this_thread::yield();
+                pos = head.load(std::memory_order_relaxed);
+            } else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+        out = std::move(cell->value);
+        cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Snapshot that may be stale by the time it returns
+    size_t approximateSize() const {
+        size_t filled = tail.load(std::memory_order_relaxed);
+        size_t emptied = head.load(std::memory_order_relaxed);
+        return filled > emptied ? filled - emptied : 0;
+    }
+};
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef NAMEINDEX_H
+#define NAMEINDEX_H
+
+#include "Patient.h"
+#include <map>
+#include <string>
+#include <vector>
+
+// Ordered index over normalized patient names (Task Owner: Member 3)
+// Names are lower-cased and whitespace-collapsed, so "  alice   JOHNSON"
+// and "Alice Johnson" share a key. Kept sorted, so a prefix lookup is a
+// single O(log n) seek followed by an O(k) walk over the matches.
+class NameIndex {
+private:
+    std::multimap<std::string, Node*> entries;
+
+public:
+    static std::string normalize(const std::string& name);
+
+    void add(Node* node);
+    void remove(Node* node);    // Uses node->data.name, call before changing it
+    void clear();
+
+    // All nodes whose normalized name equals / starts with the query
+    std::vector<Node*> findExact(const std::string& name) const;
+    std::vector<Node*> findPrefix(const std::string& prefix) const;
+
+    size_t size() const { return entries.size(); }
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include "Patient.h"
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Slab allocator for Node, shared by LinkedListADT and QueueADT
+// Nodes are carved out of large slabs instead of one heap block each, so
+// list neighbours tend to sit next to each other in memory. Freed nodes
+// go on a free list and are reused before a new slab is reserved; all
+// slabs are released in one go when the pool is destroyed.
+class NodePool {
+public:
+    struct Stats {
+        size_t liveNodes;       // Nodes currently constructed
+        size_t slabs;           // Slabs reserved from the heap
+        size_t bytesReserved;   // Total slab memory
+    };
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    static const size_t FIRST_SLAB_NODES = 32;
+    static const size_t MAX_SLAB_NODES = 4096;
+
+    std::vector<void*> slabs;
+    FreeSlot* freeList;
+    char* bumpNext;             // Unused tail of the newest slab
+    char* bumpEnd;
+    size_t nextSlabNodes;       // Slabs grow geometrically up to MAX_SLAB_NODES
+    size_t liveNodes;
+    size_t bytesReserved;
+
+    void* allocate();
+    void deallocate(void* slot);
+
+public:
+    NodePool();
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Construct a Node in pooled memory (arguments forwarded to Node's constructor)
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        void* slot = allocate();
+        try {
+            return new (slot) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(slot);
+            throw;
+        }
+    }
+
+    // Run the Node destructor and recycle its slot
+    void destroy(Node* node);
+
+    Stats getStats() const;
+};
+
+#endif
@@ -2,6 +2,7 @@
 #define PATIENT_H
 
 #include <string>
+#include <utility>
 
 // Patient structure - represents a single patient record
 struct Patient {
@@ -15,11 +16,12 @@ struct Patient {
     // Default constructor
     Patient() : age(0), priority(3) {}
 
-    // Parameterized constructor
+    // Parameterized constructor (strings are taken by value and moved in,
+    // so callers passing temporaries or std::move pay no extra copy)
     Patient(std::string id, std::string name, int age,
             std::string condition, int priority, std::string date)
-        : id(id), name(name), age(age), condition(condition),
-          priority(priority), admissionDate(date) {}
+        : id(std::move(id)), name(std::move(name)), age(age), condition(std::move(condition)),
+          priority(priority), admissionDate(std::move(date)) {}
 };
 
 // Node structure for Doubly Linked List
@@ -28,8 +30,21 @@ struct Node {
     Node* next;        // Pointer to next node
     Node* prev;        // Pointer to previous node (doubly linked)
 
-    // Constructor
-    Node(Patient p) : data(p), next(nullptr), prev(nullptr) {}
+    // QueueADT bookkeeping (unused by LinkedListADT)
+    unsigned long long seq;  // Arrival order, breaks ties within a priority
+    int heapPos;             // Slot in a re-triage heap, -1 when in a FIFO bucket
+
+    // LinkedListADT bookkeeping (unused by QueueADT)
+    int querySlot;           // Row in the list's QueryIndex, -1 when not indexed
+
+    // Constructors
+    Node(const Patient& p) : data(p), next(nullptr), prev(nullptr), seq(0), heapPos(-1), querySlot(-1) {}
+    Node(Patient&& p) : data(std::move(p)), next(nullptr), prev(nullptr), seq(0), heapPos(-1), querySlot(-1) {}
+
+    // Build the Patient in place from its constructor arguments
+    template <typename... Args>
+    Node(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr), seq(0), heapPos(-1), querySlot(-1) {}
 };
 
 #endif
\ No newline at end of file
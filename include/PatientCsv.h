@@ -0,0 +1,69 @@
+#ifndef PATIENTCSV_H
+#define PATIENTCSV_H
+
+#include "CompactPatient.h"
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Fast bulk loader for the ID,Name,Age,Condition,Priority,AdmissionDate
+// files written by LinkedListADT::saveToFile and QueueADT::saveToFile.
+// Reads the file in large blocks and splits fields in place; string
+// fields are handed out as views into the read buffer so the caller
+// allocates each string exactly once when it builds the record.
+//
+// Files saved while a journal is attached start with a
+// "# journal-lsn N" line: the journal position the file covers.
+namespace PatientCsv {
+
+    // One parsed line. Views are only valid during the callback.
+    struct Record {
+        std::string_view id;
+        std::string_view name;
+        int age;
+        std::string_view condition;
+        int priority;
+        std::string_view admissionDate;
+        long long lineNumber;
+    };
+
+    struct LoadReport {
+        long long loaded;       // Records accepted by the container
+        long long malformed;    // Lines the parser rejected
+        long long rejected;     // Well-formed lines the container refused (duplicate ID)
+        std::vector<std::string> problems;  // First MAX_PROBLEMS messages, with line numbers
+
+        LoadReport() : loaded(0), malformed(0), rejected(0) {}
+    };
+
+    const size_t MAX_PROBLEMS = 20;
+
+    // Splits and validates one line (no newline). On failure, problem says why.
+    bool parseRecord(std::string_view line, Record& rec, std::string& problem);
+
+    // Field checks shared with the snapshot loader: ID present, age 0-150,
+    // priority 1-3
+    bool checkRecord(const Record& rec, std::string& problem);
+
+    // "# journal-lsn N" header line, or "" when lsn is 0
+    std::string lsnHeader(uint64_t journalLsn);
+
+    // onRecord returns false when the container refuses the record.
+    // Returns false if the file cannot be opened. journalLsn receives the
+    // header's LSN (0 when the file has none).
+    bool load(const std::string& filename,
+              const std::function<bool(const Record&)>& onRecord,
+              LoadReport& report,
+              uint64_t* journalLsn = nullptr);
+
+    // Writes every record in store order to a temp file, fsyncs it and
+    // renames it over filename, so a crash never leaves a partial file
+    bool write(const std::string& filename, const CompactPatientStore& store,
+               uint64_t journalLsn = 0);
+
+    // One summary line plus any recorded problems
+    void printSummary(const LoadReport& report, const std::string& what, const std::string& filename);
+}
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef PATIENTQUERY_H
+#define PATIENTQUERY_H
+
+#include "Patient.h"
+#include <cstddef>
+#include <string>
+
+// Criteria for LinkedListADT::query: a record matches when it meets every
+// criterion that is set. Defaults match everything.
+struct PatientQuery {
+    int minAge, maxAge;             // Inclusive
+    unsigned int priorities;        // Bit (p - 1) set for each wanted priority; 0 = any
+    int fromDay, toDay;             // Inclusive admission day numbers (see Utils::parseDate)
+    std::string conditionText;      // Case-insensitive substring of the condition; empty = any
+    size_t limit;                   // Stop after this many matches; 0 = no limit
+
+    PatientQuery();
+
+    bool hasAgeRange() const;
+    bool hasPriorities() const { return priorities != 0; }
+    bool hasDateRange() const;
+
+    // day is the record's admission day number (INT_MIN if it has no valid date)
+    bool matches(const Patient& p, int day) const;
+    bool matchesFields(int age, int priority, int day) const;   // Everything but the condition
+    bool matchesCondition(const std::string& condition) const;
+
+    // Text form used by the QUERY batch command and the search menu:
+    // comma-separated key=value pairs, all optional, e.g.
+    //   age=65-,priority=1,from=2025-03-01,to=2025-03-07,condition=chest
+    // age is N, N-, -N or N-M; priority lists digits 1-3 (e.g. 12);
+    // from/to are YYYY-MM-DD; limit is a count. On failure, problem says why.
+    static bool parse(const std::string& spec, PatientQuery& query, std::string& problem);
+
+    // Asks for each criterion on the console (blank = any) and returns the spec
+    static std::string promptSpec();
+};
+
+#endif
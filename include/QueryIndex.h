@@ -0,0 +1,83 @@
+#ifndef QUERYINDEX_H
+#define QUERYINDEX_H
+
+#include "Patient.h"
+#include "PatientQuery.h"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Secondary indexes behind LinkedListADT::query (Task Owner: Member 3)
+//
+// Every indexed node owns a slot (Node::querySlot) holding a copy of its
+// age, priority and admission day, so most criteria are checked without
+// touching the node. Priorities are one bitmap per level over the slots;
+// ages and admission days map each value to a bucket of slots, kept in key
+// order, so a range is one O(log n) seek plus a walk over contiguous
+// buckets. Buckets give the planner the exact size of each candidate set
+// and it walks the smallest one. A query with no usable index (e.g. only a
+// condition) scans every slot. Adding or removing a record is O(log n).
+// The day buckets double as the admission-date index: range listings,
+// daily counts and the most recent admissions are O(log n + k).
+class QueryIndex {
+public:
+    // Called for each match; return false to stop early
+    typedef std::function<bool(Node*)> Visitor;
+
+private:
+    struct Slot {
+        Node* node;             // nullptr for a free slot
+        int age;
+        int priority;
+        int day;                // Admission day number, INT_MIN if the date is invalid
+        uint32_t agePos;        // Position in ageBuckets[age]
+        uint32_t dayPos;        // Position in dayBuckets[day]
+    };
+    typedef std::map<int, std::vector<uint32_t>> Buckets;
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    std::vector<uint64_t> priorityBits[3];  // Bit s set when slot s has priority p + 1
+    size_t priorityCounts[3];
+    Buckets ageBuckets;
+    Buckets dayBuckets;                     // Only records with a valid admission date
+    size_t datedCount;                      // Slots in dayBuckets
+
+    static uint32_t addToBucket(Buckets& buckets, int key, uint32_t slot);
+    void removeFromBucket(Buckets& buckets, int key, uint32_t pos, bool byDay);
+    static size_t countRange(const Buckets& buckets, int low, int high);
+
+    bool offer(uint32_t slot, const PatientQuery& query, const Visitor& visit, size_t& visited) const;
+    size_t walkRange(const Buckets& buckets, int low, int high,
+                     const PatientQuery& query, const Visitor& visit) const;
+    size_t walkPriorities(const PatientQuery& query, const Visitor& visit) const;
+    size_t walkAll(const PatientQuery& query, const Visitor& visit) const;
+
+public:
+    QueryIndex();
+
+    void add(Node* node);
+    void remove(Node* node);    // Call before changing the node's data
+    void clear();
+
+    // Visits the matches grouped by the key of the index the planner chose
+    // (up to query.limit), returning how many were visited. plan, if given,
+    // receives a one-line description of that choice.
+    size_t run(const PatientQuery& query, const Visitor& visit, std::string* plan = nullptr) const;
+
+    // Admissions on days fromDay..toDay in day order (newest day first if
+    // asked), up to limit (0 = all); O(log n + k). Returns how many were visited.
+    size_t walkDays(int fromDay, int toDay, bool newestFirst, size_t limit, const Visitor& visit) const;
+
+    // (day, admissions) for each day in the range that has any
+    std::vector<std::pair<int, size_t>> dailyCounts(int fromDay, int toDay) const;
+
+    size_t undatedCount() const { return size() - datedCount; }     // Left out of the date index
+
+    size_t size() const { return slots.size() - freeSlots.size(); }
+};
+
+#endif
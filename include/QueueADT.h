@@ -2,32 +2,132 @@
 #define QUEUEADT_H
 
 #include "Patient.h"
+#include "HashIndex.h"
+#include "NodePool.h"
+#include "CompactPatient.h"
+#include "Journal.h"
+#include "QueueEventLog.h"
+#include <cstdint>
+#include <string>
+#include <vector>
 
 // Task Owner: Member 1
 // Priority Queue for patient waiting list
+// One bucket per priority level plus a bitmask of non-empty buckets.
+// A bucket is a FIFO of arrivals (O(1) enqueue/dequeue/peek) plus a small
+// indexed min-heap for patients re-triaged into it, both ordered by arrival
+// sequence number so a re-triaged patient keeps their place in line.
 class QueueADT {
 private:
-    Node* front;
-    Node* rear;
+    static const int PRIORITY_LEVELS = 3;   // 1=Critical, 2=Urgent, 3=Normal
+
+    struct Bucket {
+        Node* front;                    // Doubly linked FIFO, seq ascending
+        Node* rear;
+        std::vector<Node*> retriaged;   // Min-heap on seq, Node::heapPos = index
+    };
+
+    Bucket buckets[PRIORITY_LEVELS];        // buckets[0] holds priority 1
+    unsigned int nonEmptyMask;              // Bit i set when buckets[i] has patients
     int size;
+    NodePool pool;                          // Slab storage for queued nodes
+    unsigned long long nextSeq;             // Monotonic arrival counter
+    HashIndex<Node*> idIndex;               // Patient::id -> Node* (position map)
+    Journal* journal;                       // Mutation log (optional, not owned)
+    uint64_t snapshotLsn;                   // Journal LSN covered by the loaded data file
+    QueueEventLog* eventLog;                // Timestamped history (optional, not owned)
+
+    static int levelOf(int priority);       // Bucket index for a priority
+    int firstLevel() const;                 // Most urgent non-empty bucket, -1 if none
+    Node* bucketFront(int level) const;     // Earliest arrival in a bucket
+
+    void attach(Node* node, int level);     // Into FIFO if in order, else heap
+    void detach(Node* node, int level);     // Out of FIFO or heap
+    void updateMask(int level);
+
+    // Re-triage heap helpers (O(log n))
+    void heapPush(int level, Node* node);
+    void heapErase(int level, int pos);
+    void siftUp(std::vector<Node*>& heap, int pos);
+    void siftDown(std::vector<Node*>& heap, int pos);
+
+    bool admit(Node* newNode, bool verbose = true);  // Sequence, index and bucket a new node
+
+    // All waiting patients in service order
+    std::vector<const Node*> orderedNodes() const;
+
+public:
+    // Position in service order for paged display. Only valid until the
+    // queue is next modified.
+    struct PageCursor {
+        int level;          // Bucket; PRIORITY_LEVELS once past the end
+        const Node* fifo;   // Next FIFO node in that bucket (nullptr = FIFO done)
+        size_t heapIndex;   // Next entry of the bucket's re-triaged patients, by seq
+        long long index;    // 0-based service position, -1 if unknown
+    };
+
+private:
+    typedef std::vector<const Node*> SortedRetriaged[PRIORITY_LEVELS];
+    void sortRetriaged(SortedRetriaged& sorted) const;
+    void settle(PageCursor& cursor, const SortedRetriaged& sorted) const;   // Skip exhausted buckets
+    const Node* stepForward(PageCursor& cursor, const SortedRetriaged& sorted) const;
+    bool stepBackward(PageCursor& cursor, const SortedRetriaged& sorted) const;
 
 public:
     QueueADT();
     ~QueueADT();
 
     // Core operations
-    void enqueue(Patient p);           // Add patient to queue
+    static bool isValidPriority(int priority) { return priority >= 1 && priority <= PRIORITY_LEVELS; }
+
+    // Add patient to queue; false for an ID already waiting or a priority outside 1-3
+    bool enqueue(const Patient& p);
+    bool enqueue(Patient&& p);
+
+    template <typename... Args>
+    bool emplace(Args&&... args) {      // Construct the Patient inside the queue node
+        return admit(pool.create(std::in_place, std::forward<Args>(args)...));
+    }
     Patient dequeue();                  // Remove front patient
     Patient peek() const;               // View front patient without removing
 
+    // Re-triage and departures (O(log n)); retriage is false for an
+    // unknown ID or a priority outside 1-3
+    bool retriage(const std::string& id, int newPriority);
+    bool remove(const std::string& id);
+    const Patient* find(const std::string& id) const;
+
     // Utility
     bool isEmpty() const;
     int getSize() const;
+    NodePool::Stats getPoolStats() const { return pool.getStats(); }
     void display() const;               // Show all patients in queue
 
-    // File operations
-    void saveToFile(const std::string& filename) const;
+    // Paged listing: O(page size + re-triaged patients) per move. A pageSize
+    // below 1 is rejected as in LinkedListADT.
+    PageCursor firstPage() const;
+    PageCursor lastPage(int pageSize) const;
+    PageCursor nextPage(const PageCursor& page, int pageSize) const;     // Same page if already last
+    PageCursor prevPage(const PageCursor& page, int pageSize) const;
+    PageCursor jumpToPage(long long pageNumber, int pageSize) const;     // 1-based, O(position)
+    bool pageFromID(const std::string& id, PageCursor& page) const;
+    void displayPage(const PageCursor& page, int pageSize) const;
+    std::vector<const Patient*> pageRecords(const PageCursor& page, int pageSize) const;
+
+    // File operations (".snap"/".bin" = binary snapshot, anything else = CSV)
+    bool saveToFile(const std::string& filename) const;     // False (with a message) if not written
     void loadFromFile(const std::string& filename);
+
+    // Compact copy of the queue in service order
+    void archiveTo(CompactPatientStore& store) const;
+
+    // Write-ahead journal: attach after loading; see LinkedListADT
+    void setJournal(Journal* j) { journal = j; }
+    uint64_t getSnapshotLsn() const { return snapshotLsn; }
+    void applyJournalEntry(const Journal::Entry& entry);
+
+    // Event history: attach after loading/replay so only live actions are recorded
+    void setEventLog(QueueEventLog* log) { eventLog = log; }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,63 @@
+#ifndef QUEUEEVENTLOG_H
+#define QUEUEEVENTLOG_H
+
+#include "Patient.h"
+#include <cstdio>
+#include <string>
+
+class QueueADT;
+
+// Timestamped, append-only history of the waiting queue (queue_log.txt)
+//
+// One line per event, oldest first; the third field is the logged-in user
+// who performed it (for DEQUEUE, the staff member who served the patient):
+//   2025-01-18 09:30:12,ENQUEUE,admin,P005,Emma Green,35,Checkup,3,2025-01-18
+//   2025-01-18 09:45:55,RETRIAGE,doctor,P005,1
+//   2025-01-18 09:52:40,DEQUEUE,doctor,P005
+//   2025-01-18 10:03:17,REMOVE,admin,P006
+//
+// The current queue contents are saved separately (queue.txt / queue.snap).
+// This file is the audit trail: replaying it up to a cutoff rebuilds the
+// queue as it stood at that moment.
+class QueueEventLog {
+private:
+    FILE* file;
+    std::string operatorName;
+
+    void write(const std::string& event, const std::string& fields);
+
+public:
+    QueueEventLog();
+    ~QueueEventLog();
+
+    QueueEventLog(const QueueEventLog&) = delete;
+    QueueEventLog& operator=(const QueueEventLog&) = delete;
+
+    bool open(const std::string& filename);     // Opens for appending
+    void close();
+
+    void setOperator(const std::string& username);
+
+    void logEnqueue(const Patient& p);
+    void logDequeue(const std::string& id);
+    void logRemove(const std::string& id);
+    void logRetriage(const std::string& id, int newPriority);
+
+    // "YYYY-MM-DD", "YYYY-MM-DD HH:MM" or "YYYY-MM-DD HH:MM:SS", a real
+    // calendar date and 24-hour time
+    static bool isValidCutoff(const std::string& until);
+
+    // Applies every event stamped at or before 'until' (a valid cutoff; a
+    // shorter one covers its whole day or minute) to queue, which should
+    // start empty. Reading stops at the first event past the cutoff. Lines
+    // with a bad timestamp, unknown event or invalid field are skipped and
+    // counted in skipped. Returns the number of events applied, or -1 if the
+    // file cannot be read or the cutoff is invalid.
+    static long long replay(const std::string& filename, const std::string& until, QueueADT& queue,
+                            long long* skipped = nullptr);
+
+    // False when the file holds a plain queue dump (the pre-event-log format)
+    static bool isEventLog(const std::string& filename);
+};
+
+#endif
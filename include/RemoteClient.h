@@ -0,0 +1,56 @@
+#ifndef REMOTECLIENT_H
+#define REMOTECLIENT_H
+
+#include "Patient.h"
+#include <string>
+#include <vector>
+
+// Interactive front end for a running server (--connect=PATH)
+//
+// Shows the same login, admin and doctor menus as the local program, but
+// every action is one request to the server (see Server.h), so any number
+// of clients can work on the same records at once. Queue history, user
+// management and statistics stay with the server's own console.
+class RemoteClient {
+private:
+    int fd;
+    std::string pending;        // Bytes read past the last response line
+    std::string username;
+    bool admin;
+    bool connected;
+    bool done;                  // The user chose Exit
+
+    // Sends one request; fields receives the tab-separated response
+    // (fields[0] is "OK" or "ERR"). False on ERR or a lost connection.
+    bool request(const std::string& line, std::vector<std::string>& fields);
+    bool readLine(std::string& line);
+
+    void showLoginMenu();
+    void showAdminMenu();
+    void showDoctorMenu();
+
+    void addPatientRecord();
+    void searchPatient();
+    void deletePatientRecord();
+    void browsePages(const std::string& command, const std::string& title);
+    void sortPatients();
+    void editPatientRecord();
+    void addPatientToQueue();
+    void processNextPatient();
+    void retriagePatient();
+    void removeFromQueue();
+
+public:
+    RemoteClient();
+    ~RemoteClient();
+
+    RemoteClient(const RemoteClient&) = delete;
+    RemoteClient& operator=(const RemoteClient&) = delete;
+
+    bool connect(const std::string& path);      // False with a message on failure
+
+    // Menu loop until the user exits or the server goes away; returns the exit code
+    int run();
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "BatchRunner.h"
+#include "UserManager.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Daemon mode: hosts the containers and serves local clients over a Unix
+// domain socket (POSIX only).
+//
+// Protocol: one request line, one response line, both '\n'-terminated.
+// Requests use the BatchRunner grammar plus three session commands:
+//   LOGIN  username,password   ->  OK<TAB>LOGIN<TAB>ADMIN|DOCTOR
+//   LOGOUT
+//   QUIT                           (server closes the connection after replying)
+// Everything except LOGIN and QUIT needs a login; doctors may only read,
+// serve (DEQUEUE), re-triage and remove.
+//
+// One poll() thread reads requests from every connection and hands complete
+// lines to a pool of worker threads (one request per connection in flight,
+// so replies stay in order). Read-only commands run concurrently under a
+// shared lock; anything that changes the containers takes it exclusively.
+class Server {
+public:
+    // Called under the exclusive lock around every change: before (with the
+    // requesting user, e.g. for the event log) and after (e.g. journal commit)
+    typedef std::function<void(const std::string& username)> BeforeWrite;
+    typedef std::function<void()> AfterWrite;
+
+private:
+    struct Session {
+        std::string username;       // Empty until LOGIN succeeds
+        UserRole role;
+        bool quit;
+
+        Session() : role(DOCTOR), quit(false) {}
+    };
+
+    struct Connection {
+        std::string inbox;          // Bytes received but not yet handled
+        Session session;
+        bool busy;                  // A worker owns the next request
+        bool closing;               // QUIT handled or the peer went away
+
+        Connection() : busy(false), closing(false) {}
+    };
+
+    BatchRunner runner;
+    const UserManager& users;
+    BeforeWrite beforeWrite;
+    AfterWrite afterWrite;
+
+    std::shared_mutex dataLock;         // Guards the containers
+
+    std::mutex stateMutex;              // Guards everything below
+    std::condition_variable jobReady;
+    std::map<int, Connection> connections;
+    std::deque<int> jobs;               // Connections with a request to run
+    bool shuttingDown;
+
+    std::vector<std::thread> workers;
+    std::string socketPath;
+    int listenFd;
+    int wakePipe[2];                    // Wakes poll() (worker done, or stop())
+    std::atomic<bool> stopRequested;
+
+    void acceptClients();
+    bool readFrom(int fd);              // False once the peer has gone
+    void dispatchReady();               // Queue connections holding a full line
+    void closeFinished();
+    void workerLoop();
+    void wake();
+    std::string handle(const std::string& line, Session& session);
+
+public:
+    Server(LinkedListADT& patientList, QueueADT& queue, const UserManager& users);
+    ~Server();
+
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+
+    void setSaveHandler(const std::function<bool()>& handler) { runner.setSaveHandler(handler); }
+    void setWriteHooks(const BeforeWrite& before, const AfterWrite& after);
+
+    // Binds the socket (replacing a stale one). False with a message on failure.
+    bool listen(const std::string& path);
+
+    // Serves until stop(); returns after in-flight requests finish
+    void run(int workerCount);
+
+    // Async-signal-safe; run() returns soon after
+    void stop();
+};
+
+#endif
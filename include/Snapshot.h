@@ -0,0 +1,50 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "CompactPatient.h"
+#include "PatientCsv.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// Versioned binary snapshot format for patient records and the queue
+//
+//   Header      magic "MEDIFLOW", version, kind, record count,
+//               payload size, FNV-1a checksum of the payload,
+//               journal LSN covered by the snapshot (version 2+)
+//   Strings     uint32 count, then (uint32 length, bytes) per string
+//               (interned conditions and non-standard date text)
+//   Arena       uint64 length, then the name / long-ID characters
+//   Records     recordCount fixed-width 32-byte CompactPatient entries
+//
+// Values are stored in host byte order (little-endian on all supported
+// platforms). Files are written to a temp file and renamed into place.
+// Loading maps the file, checks the payload checksum in one pass, then
+// decodes the records in a second pass, so a corrupt file hands no
+// records to the caller.
+namespace Snapshot {
+
+    enum Kind {
+        PATIENT_RECORDS = 1,
+        QUEUE = 2
+    };
+
+    const uint32_t FORMAT_VERSION = 2;      // Version 1 files (no LSN) still load
+
+    // ".snap" / ".bin" files use this format, anything else is CSV
+    bool isSnapshotFile(const std::string& filename);
+
+    bool write(const std::string& filename, Kind kind, const CompactPatientStore& store,
+               uint64_t journalLsn = 0);
+
+    // Streams every record to onRecord in stored order. Records that fail
+    // PatientCsv::checkRecord count as malformed and are not passed on.
+    // Returns false if the file cannot be opened; a corrupt file is
+    // reported through the report.
+    bool load(const std::string& filename, Kind kind,
+              const std::function<bool(const PatientCsv::Record&)>& onRecord,
+              PatientCsv::LoadReport& report,
+              uint64_t* journalLsn = nullptr);
+}
+
+#endif
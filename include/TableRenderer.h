@@ -0,0 +1,49 @@
+#ifndef TABLERENDERER_H
+#define TABLERENDERER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Builds a whole screen of text (titles, rules, padded table rows) in one
+// buffer and writes it to the terminal in a single call, instead of one
+// iostream write per field. The buffer is recycled between renderers on
+// the same thread, so repeated listings do not reallocate.
+class TableRenderer {
+public:
+    struct Column {
+        std::string title;
+        size_t width;       // Cells are left-aligned and padded to this width (last column is not padded)
+    };
+
+private:
+    std::string buffer;
+    std::vector<Column> columns;
+    size_t currentColumn;
+
+    void pad(size_t used, size_t width);
+
+public:
+    TableRenderer();
+    ~TableRenderer();
+
+    TableRenderer(const TableRenderer&) = delete;
+    TableRenderer& operator=(const TableRenderer&) = delete;
+
+    void reserveRows(size_t rows);              // Pre-size for a known row count
+
+    void setColumns(const std::vector<Column>& cols);
+    void header();                              // Column titles as a row
+    void rule(char c, size_t width);            // e.g. a line of '=' or '-'
+    void text(std::string_view line);           // Raw text, appended as-is
+
+    // One row: cell(...) per column, then endRow()
+    TableRenderer& cell(std::string_view value);
+    TableRenderer& cell(long long value);
+    void endRow();
+
+    // Writes everything buffered so far with one write, then empties the buffer
+    void flush();
+};
+
+#endif
@@ -1,8 +1,9 @@
 #ifndef USERMANAGER_H
 #define USERMANAGER_H
 
+#include "HashIndex.h"
 #include <string>
-
+#include <vector>
 
 // User roles
 enum UserRole {
@@ -22,19 +23,16 @@ struct User {
         : username(u), password(p), role(r) {}
 };
 
-// Constant for maximum users
-const int MAX_USERS = 50;
-
 class UserManager {
 private:
 
-    User users[MAX_USERS];
-    int userCount;
+    HashIndex<User> users;      // Username -> User, grows as needed (no account limit)
 
     User currentUser;
     bool isLoggedIn;
 
     void initializeDefaultUsers();
+    std::vector<const User*> sortedUsers() const;   // Stable order for display and saving
 
 public:
     UserManager();
@@ -43,10 +41,15 @@ public:
     bool login(const std::string& username, const std::string& password);
     void logout();
 
+    // Credential check without a session or messages (server mode; safe
+    // to call from several threads while no user is being added or deleted)
+    bool authenticate(const std::string& username, const std::string& password, UserRole& role) const;
+
     // User management (Admin only)
     bool addUser(const std::string& username, const std::string& password, UserRole role);
     bool deleteUser(const std::string& username);
     void displayAllUsers() const;
+    int getUserCount() const { return static_cast<int>(users.size()); }
 
     // Access control
     bool isAuthenticated() const { return isLoggedIn; }
@@ -10,6 +10,7 @@ namespace Utils {
 
     int getIntInput(const std::string& prompt, int min, int max);
     std::string getStringInput(const std::string& prompt);
+    std::string getDateInput(const std::string& prompt);      // Asks again until it is a valid YYYY-MM-DD
     bool confirmAction(const std::string& message);
 
     void printHeader(const std::string& title);
@@ -18,6 +19,15 @@ namespace Utils {
     void printSuccess(const std::string& message);
 
     void createDirectoryIfNotExists(const std::string& path);
+    bool fileExists(const std::string& path);
+
+    // Dates as day numbers (days since 1970-01-01)
+    bool parseDate(const std::string& text, int& dayNumber);   // Strict YYYY-MM-DD
+    std::string formatDate(int dayNumber);                     // Back to YYYY-MM-DD
+    bool parseTimeOfDay(const std::string& text, int& seconds); // Strict HH:MM or HH:MM:SS (24-hour)
+
+    // Local wall-clock time as "YYYY-MM-DD HH:MM:SS" (sorts as text)
+    std::string currentTimestamp();
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,378 @@
+#include "../include/BatchRunner.h"
+#include "../include/PatientCsv.h"
+#include "../include/PatientQuery.h"
+#include "../include/Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+
+static const size_t FLUSH_BYTES = 1 << 16;   // Write results in 64 KiB chunks
+
+BatchRunner::BatchRunner(LinkedListADT& list, QueueADT& q) : patientList(list), queue(q) {}
+
+static void appendRecord(string& out, const Patient& p) {
+    out += p.id;
+    out += ',';
+    out += p.name;
+    out += ',';
+    out += to_string(p.age);
+    out += ',';
+    out += p.condition;
+    out += ',';
+    out += to_string(p.priority);
+    out += ',';
+    out += p.admissionDate;
+}
+
+static bool ok(string& result, const string& command, const string& detail = "") {
+    result += "OK\t";
+    result += command;
+    if (!detail.empty()) {
+        result += '\t';
+        result += detail;
+    }
+    result += '\n';
+    return true;
+}
+
+static bool fail(string& result, const string& command, const string& message) {
+    result += "ERR\t";
+    result += command;
+    result += '\t';
+    result += message;
+    result += '\n';
+    return false;
+}
+
+static const long long DEFAULT_PAGE_SIZE = 20;
+
+// Records are parsed leniently on load; new ones must carry a real date
+static bool checkDate(const PatientCsv::Record& rec, string& problem) {
+    int day;
+    if (Utils::parseDate(string(rec.admissionDate), day)) return true;
+    problem = "invalid admission date '" + string(rec.admissionDate) + "' (YYYY-MM-DD)";
+    return false;
+}
+
+// "YYYY-MM-DD,YYYY-MM-DD[,limit]" -> inclusive day range (limit only where allowed)
+static bool parseDayRange(const string& args, int& fromDay, int& toDay, size_t* limit = nullptr) {
+    size_t comma = args.find(',');
+    if (comma == string::npos || !Utils::parseDate(args.substr(0, comma), fromDay)) return false;
+    string rest = args.substr(comma + 1);
+    size_t second = rest.find(',');
+    if (limit != nullptr) {
+        *limit = 0;
+        if (second != string::npos) {
+            char* end;
+            long long n = strtoll(rest.c_str() + second + 1, &end, 10);
+            if (*end != '\0' || n < 1) return false;
+            *limit = static_cast<size_t>(n);
+            rest.erase(second);
+        }
+    }
+    return Utils::parseDate(rest, toDay) && fromDay <= toDay;
+}
+
+// "page[,size]" -> 1-based page and a size of 1-1000
+static bool parsePage(const string& args, long long& page, long long& pageSize) {
+    char* end;
+    page = strtoll(args.c_str(), &end, 10);
+    pageSize = DEFAULT_PAGE_SIZE;
+    if (*end == ',') pageSize = strtoll(end + 1, &end, 10);
+    return end != args.c_str() && *end == '\0' && page >= 1 && pageSize >= 1 && pageSize <= 1000;
+}
+
+// page, page count, total, then one record per field
+template <typename Container>
+static void appendPage(string& detail, const Container& container, long long total,
+                       long long page, long long pageSize) {
+    long long pages = (total == 0) ? 1 : (total - 1) / pageSize + 1;
+    page = min(page, pages);
+    detail = to_string(page) + "\t" + to_string(pages) + "\t" + to_string(total);
+    typename Container::PageCursor cursor = container.jumpToPage(page, static_cast<int>(pageSize));
+    for (const Patient* p : container.pageRecords(cursor, static_cast<int>(pageSize))) {
+        detail += '\t';
+        appendRecord(detail, *p);
+    }
+}
+
+bool BatchRunner::isReadOnly(const string& command) {
+    return command == "SEARCH" || command == "FIND" || command == "QUERY" || command == "COUNT" ||
+           command == "ADMITTED" || command == "RECENT" || command == "DAILY" ||
+           command == "LIST" || command == "QUEUE" || command == "WAITING";
+}
+
+static Patient toPatient(const PatientCsv::Record& rec) {
+    return Patient(string(rec.id), string(rec.name), rec.age,
+                   string(rec.condition), rec.priority, string(rec.admissionDate));
+}
+
+bool BatchRunner::execute(const string& line, string& result) {
+    // Verb is case-insensitive; everything after the first space is the argument
+    size_t space = line.find(' ');
+    string command = line.substr(0, space);
+    transform(command.begin(), command.end(), command.begin(),
+              [](unsigned char c) { return static_cast<char>(toupper(c)); });
+    string args;
+    if (space != string::npos) {
+        size_t argStart = line.find_first_not_of(' ', space);
+        if (argStart != string::npos) args = line.substr(argStart);
+    }
+
+    PatientCsv::Record rec;
+    string problem;
+
+    if (command == "ADD" || command == "UPDATE") {
+        if (!PatientCsv::parseRecord(args, rec, problem) || !checkDate(rec, problem)) {
+            return fail(result, command, problem);
+        }
+        string id(rec.id);
+        if (command == "ADD") {
+            if (!patientList.insertPatient(toPatient(rec))) {
+                return fail(result, command, "duplicate ID " + id);
+            }
+        } else if (!patientList.updatePatient(id, toPatient(rec))) {
+            return fail(result, command, "no patient with ID " + id);
+        }
+        return ok(result, command, id);
+    }
+
+    if (command == "DELETE") {
+        if (!patientList.deletePatient(args)) {
+            return fail(result, command, "no patient with ID " + args);
+        }
+        return ok(result, command, args);
+    }
+
+    if (command == "SEARCH") {
+        Node* node = patientList.searchByID(args);
+        if (node == nullptr) {
+            return fail(result, command, "no patient with ID " + args);
+        }
+        string detail;
+        appendRecord(detail, node->data);
+        return ok(result, command, detail);
+    }
+
+    if (command == "FIND") {
+        vector<Node*> matches = patientList.searchByNamePrefix(args);
+        string detail = to_string(matches.size());
+        for (Node* node : matches) {
+            detail += '\t';
+            appendRecord(detail, node->data);
+        }
+        return ok(result, command, detail);
+    }
+
+    if (command == "QUERY") {
+        PatientQuery query;
+        string problem;
+        if (!PatientQuery::parse(args, query, problem)) {
+            return fail(result, command, problem);
+        }
+        vector<Node*> matches = patientList.query(query);
+        string detail = to_string(matches.size());
+        for (Node* node : matches) {
+            detail += '\t';
+            appendRecord(detail, node->data);
+        }
+        return ok(result, command, detail);
+    }
+
+    if (command == "ADMITTED" || command == "RECENT") {
+        vector<Node*> matches;
+        if (command == "ADMITTED") {
+            int fromDay, toDay;
+            size_t limit;
+            if (!parseDayRange(args, fromDay, toDay, &limit)) {
+                return fail(result, command, "expected from,to[,limit] as YYYY-MM-DD,YYYY-MM-DD[,N]");
+            }
+            matches = patientList.admittedBetween(fromDay, toDay, limit);
+        } else {
+            char* end;
+            long long n = strtoll(args.c_str(), &end, 10);
+            if (end == args.c_str() || *end != '\0' || n < 1 || n > 100000) {
+                return fail(result, command, "expected a count of 1-100000");
+            }
+            matches = patientList.mostRecentAdmissions(static_cast<size_t>(n));
+        }
+        string detail = to_string(matches.size());
+        for (Node* node : matches) {
+            detail += '\t';
+            appendRecord(detail, node->data);
+        }
+        return ok(result, command, detail);
+    }
+
+    if (command == "DAILY") {
+        int fromDay, toDay;
+        if (!parseDayRange(args, fromDay, toDay)) {
+            return fail(result, command, "expected from,to as YYYY-MM-DD,YYYY-MM-DD");
+        }
+        vector<pair<int, size_t>> days = patientList.dailyAdmissions(fromDay, toDay);
+        size_t total = 0;
+        string detail;
+        for (const auto& day : days) {
+            total += day.second;
+            detail += '\t';
+            detail += Utils::formatDate(day.first);
+            detail += ',';
+            detail += to_string(day.second);
+        }
+        return ok(result, command, to_string(total) + detail);
+    }
+
+    if (command == "SORT") {
+        string key = args;
+        transform(key.begin(), key.end(), key.begin(),
+                  [](unsigned char c) { return static_cast<char>(toupper(c)); });
+        if (key == "NAME") {
+            patientList.sortByName();
+        } else if (key == "PRIORITY") {
+            patientList.sortByPriority();
+        } else if (key == "TRIAGE") {
+            patientList.sortBy(LinkedListADT::triageOrder);
+        } else {
+            return fail(result, command, "expected NAME, PRIORITY or TRIAGE");
+        }
+        return ok(result, command, key);
+    }
+
+    if (command == "ENQUEUE") {
+        if (args.find(',') == string::npos) {
+            // Copy of the stored record
+            Node* node = patientList.searchByID(args);
+            if (node == nullptr) {
+                return fail(result, command, "no patient with ID " + args);
+            }
+            if (!QueueADT::isValidPriority(node->data.priority)) {
+                return fail(result, command, "record priority " + to_string(node->data.priority) + " is not 1-3");
+            }
+            if (!queue.enqueue(node->data)) {
+                return fail(result, command, "already waiting: " + args);
+            }
+            return ok(result, command, args);
+        }
+        if (!PatientCsv::parseRecord(args, rec, problem) || !checkDate(rec, problem)) {
+            return fail(result, command, problem);
+        }
+        string id(rec.id);
+        if (!queue.enqueue(toPatient(rec))) {
+            return fail(result, command, "already waiting: " + id);
+        }
+        return ok(result, command, id);
+    }
+
+    if (command == "DEQUEUE") {
+        if (queue.isEmpty()) {
+            return fail(result, command, "queue is empty");
+        }
+        string detail;
+        appendRecord(detail, queue.dequeue());
+        return ok(result, command, detail);
+    }
+
+    if (command == "RETRIAGE") {
+        size_t comma = args.find(',');
+        if (comma == string::npos || comma == 0) {
+            return fail(result, command, "expected id,priority with priority 1-3");
+        }
+        const char* value = args.c_str() + comma + 1;
+        char* end;
+        long long priority = strtoll(value, &end, 10);
+        if (end == value || *end != '\0' || priority < 1 || priority > 3) {
+            return fail(result, command, "invalid priority '" + string(value) + "' (expected 1-3)");
+        }
+        string id = args.substr(0, comma);
+        if (!queue.retriage(id, static_cast<int>(priority))) {
+            return fail(result, command, "not waiting: " + id);
+        }
+        return ok(result, command, id + "," + to_string(priority));
+    }
+
+    if (command == "REMOVE") {
+        if (!queue.remove(args)) {
+            return fail(result, command, "not waiting: " + args);
+        }
+        return ok(result, command, args);
+    }
+
+    if (command == "WAITING") {
+        const Patient* waiting = queue.find(args);
+        if (waiting == nullptr) {
+            return fail(result, command, "not waiting: " + args);
+        }
+        string detail;
+        appendRecord(detail, *waiting);
+        return ok(result, command, detail);
+    }
+
+    if (command == "LIST" || command == "QUEUE") {
+        long long page, pageSize;
+        if (!parsePage(args, page, pageSize)) {
+            return fail(result, command, "expected page[,size] with size 1-1000");
+        }
+        string detail;
+        if (command == "LIST") {
+            appendPage(detail, patientList, patientList.getCount(), page, pageSize);
+        } else {
+            appendPage(detail, queue, queue.getSize(), page, pageSize);
+        }
+        return ok(result, command, detail);
+    }
+
+    if (command == "COUNT") {
+        return ok(result, command, "records=" + to_string(patientList.getCount()) +
+                                   "\tqueue=" + to_string(queue.getSize()));
+    }
+
+    if (command == "SAVE") {
+        if (!saveHandler || !saveHandler()) {
+            return fail(result, command, "save failed");
+        }
+        return ok(result, command);
+    }
+
+    return fail(result, command, "unknown command");
+}
+
+long long BatchRunner::run(istream& in, ostream& out) {
+    // The containers report to cout; a failed stream turns that into no-ops
+    ios::iostate consoleState = cout.rdstate();
+    cout.setstate(ios::badbit);
+
+    string buffer;
+    buffer.reserve(FLUSH_BYTES * 2);
+    long long lineNumber = 0, succeeded = 0, failed = 0;
+    string line;
+
+    while (getline(in, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        size_t start = line.find_first_not_of(" \t");
+        if (start == string::npos || line[start] == '#') continue;
+
+        buffer += to_string(lineNumber);
+        buffer += '\t';
+        if (execute(line.substr(start), buffer)) {
+            succeeded++;
+        } else {
+            failed++;
+        }
+
+        if (buffer.size() >= FLUSH_BYTES) {
+            out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+
+    buffer += "DONE\tok=" + to_string(succeeded) + "\terr=" + to_string(failed) + "\n";
+    out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+    out.flush();
+
+    cout.clear(consoleState);
+    return failed;
+}
@@ -0,0 +1,135 @@
+#include "../include/Checkpointer.h"
+#include "../include/Utils.h"
+#include "../include/PatientCsv.h"
+#include "../include/Snapshot.h"
+#include <utility>
+
+using namespace std;
+
+Checkpointer::Checkpointer(Journal& j)
+    : journal(j), intervalSeconds(60), recordThreshold(1000),
+      busy(false), finished(false), succeeded(false), stopping(false),
+      lastCheckpoint(chrono::steady_clock::now()) {}
+
+Checkpointer::~Checkpointer() {
+    stop();
+}
+
+void Checkpointer::configure(int seconds, long long records) {
+    intervalSeconds = seconds < 1 ? 1 : seconds;
+    recordThreshold = records < 1 ? 1 : records;
+}
+
+void Checkpointer::start(const string& patients, const string& queue) {
+    if (worker.joinable()) {
+        return;
+    }
+    patientsFile = patients;
+    queueFile = queue;
+    stopping = false;
+    lastCheckpoint = chrono::steady_clock::now();
+    worker = thread(&Checkpointer::run, this);
+}
+
+void Checkpointer::stop() {
+    if (!worker.joinable()) {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();
+    collect();
+}
+
+static bool writeFile(const string& filename, Snapshot::Kind kind,
+                      const CompactPatientStore& store, uint64_t lsn) {
+    if (Snapshot::isSnapshotFile(filename)) {
+        return Snapshot::write(filename, kind, store, lsn);
+    }
+    return PatientCsv::write(filename, store, lsn);
+}
+
+void Checkpointer::run() {
+    unique_lock<mutex> lock(stateMutex);
+    while (true) {
+        wake.wait(lock, [this] { return (busy && !finished) || stopping; });
+        if (!busy || finished) {
+            return;   // Stopping with nothing left to write
+        }
+
+        Job work = std::move(job);
+        lock.unlock();
+
+        bool ok = writeFile(patientsFile, Snapshot::PATIENT_RECORDS, work.records, work.lsn) &&
+                  writeFile(queueFile, Snapshot::QUEUE, work.queue, work.lsn);
+
+        lock.lock();
+        succeeded = ok;
+        finished = true;
+    }
+}
+
+void Checkpointer::collect() {
+    bool ok;
+    {
+        lock_guard<mutex> lock(stateMutex);
+        if (!busy || !finished) {
+            return;
+        }
+        ok = succeeded;
+        busy = false;
+        finished = false;
+    }
+
+    if (ok) {
+        journal.discardRotated();   // Now covered by the files on disk
+    } else {
+        // The retired records stay on disk and are replayed on startup
+        Utils::printError("Background save failed; changes remain in the journal.");
+    }
+}
+
+void Checkpointer::poll(const LinkedListADT& patientList, const QueueADT& queue) {
+    if (!worker.joinable()) {
+        return;
+    }
+    collect();
+    {
+        lock_guard<mutex> lock(stateMutex);
+        if (busy) {
+            return;   // One checkpoint at a time
+        }
+    }
+
+    long long pending = journal.getRecordsInFile();
+    auto now = chrono::steady_clock::now();
+    bool due = pending >= recordThreshold ||
+               (pending > 0 && now - lastCheckpoint >= chrono::seconds(intervalSeconds));
+    if (!due) {
+        return;
+    }
+
+    // Consistent copy of both containers as of the newest journal record
+    Job next;
+    patientList.archiveTo(next.records);
+    queue.archiveTo(next.queue);
+    if (!journal.commit()) {
+        return;   // Records not durable yet; try again after the next action
+    }
+    next.lsn = journal.getLastLsn();
+    if (!journal.rotate()) {
+        return;   // Keep journaling; try again after the next action
+    }
+    lastCheckpoint = now;
+
+    {
+        lock_guard<mutex> lock(stateMutex);
+        job = std::move(next);
+        busy = true;
+        finished = false;
+    }
+    wake.notify_one();
+}
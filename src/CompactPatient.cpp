@@ -0,0 +1,130 @@
+#include "../include/CompactPatient.h"
+#include "../include/Utils.h"
+#include <cstring>
+
+using namespace std;
+
+uint32_t StringPool::intern(const string& value) {
+    const uint32_t* existing = lookup.find(value);
+    if (existing != nullptr) {
+        return *existing;
+    }
+    uint32_t id = static_cast<uint32_t>(values.size());
+    values.push_back(value);
+    lookup.insert(value, id);
+    return id;
+}
+
+void StringPool::clear() {
+    values.clear();
+    lookup.clear();
+}
+
+void CompactPatientStore::append(const Patient& p) {
+    CompactPatient rec;
+    memset(&rec, 0, sizeof(rec));
+
+    if (p.id.size() <= sizeof(rec.id)) {
+        memcpy(rec.id, p.id.data(), p.id.size());
+        rec.idLength = static_cast<uint8_t>(p.id.size());
+    } else {
+        uint32_t offset = static_cast<uint32_t>(arena.size());
+        uint32_t length = static_cast<uint32_t>(p.id.size());
+        arena += p.id;
+        memcpy(rec.id, &offset, sizeof(offset));
+        memcpy(rec.id + sizeof(offset), &length, sizeof(length));
+        rec.flags |= CompactPatient::FLAG_LONG_ID;
+    }
+
+    rec.nameOffset = static_cast<uint32_t>(arena.size());
+    rec.nameLength = static_cast<uint32_t>(p.name.size());
+    arena += p.name;
+
+    if (p.age >= 0 && p.age <= 65535 && p.priority >= -128 && p.priority <= 127) {
+        rec.age = static_cast<uint16_t>(p.age);
+        rec.priority = static_cast<int8_t>(p.priority);
+    } else {
+        int32_t wide[2] = {p.age, p.priority};
+        arena.append(reinterpret_cast<const char*>(wide), sizeof(wide));
+        rec.flags |= CompactPatient::FLAG_WIDE_NUMBERS;
+    }
+    rec.conditionId = strings.intern(p.condition);
+
+    int day;
+    if (Utils::parseDate(p.admissionDate, day)) {
+        rec.admissionDay = day;
+    } else {
+        rec.admissionDay = static_cast<int32_t>(strings.intern(p.admissionDate));
+        rec.flags |= CompactPatient::FLAG_RAW_DATE;
+    }
+
+    records.push_back(rec);
+}
+
+string CompactPatientStore::idAt(size_t index) const {
+    const CompactPatient& rec = records[index];
+    if (rec.flags & CompactPatient::FLAG_LONG_ID) {
+        uint32_t offset, length;
+        memcpy(&offset, rec.id, sizeof(offset));
+        memcpy(&length, rec.id + sizeof(offset), sizeof(length));
+        return arena.substr(offset, length);
+    }
+    return string(rec.id, rec.idLength);
+}
+
+string CompactPatientStore::nameAt(size_t index) const {
+    const CompactPatient& rec = records[index];
+    return arena.substr(rec.nameOffset, rec.nameLength);
+}
+
+// Exact values of a FLAG_WIDE_NUMBERS record: age, then priority
+static int32_t wideField(const CompactPatient& rec, const string& arena, int field) {
+    int32_t value;
+    memcpy(&value, arena.data() + rec.nameOffset + rec.nameLength + field * sizeof(int32_t), sizeof(value));
+    return value;
+}
+
+int CompactPatientStore::ageAt(size_t index) const {
+    const CompactPatient& rec = records[index];
+    return (rec.flags & CompactPatient::FLAG_WIDE_NUMBERS) ? wideField(rec, arena, 0) : rec.age;
+}
+
+int CompactPatientStore::priorityAt(size_t index) const {
+    const CompactPatient& rec = records[index];
+    return (rec.flags & CompactPatient::FLAG_WIDE_NUMBERS) ? wideField(rec, arena, 1) : rec.priority;
+}
+
+const string& CompactPatientStore::conditionAt(size_t index) const {
+    return strings.get(records[index].conditionId);
+}
+
+string CompactPatientStore::admissionDateAt(size_t index) const {
+    const CompactPatient& rec = records[index];
+    if (rec.flags & CompactPatient::FLAG_RAW_DATE) {
+        return strings.get(static_cast<uint32_t>(rec.admissionDay));
+    }
+    return Utils::formatDate(rec.admissionDay);
+}
+
+Patient CompactPatientStore::get(size_t index) const {
+    return Patient(idAt(index), nameAt(index), ageAt(index),
+                   conditionAt(index), priorityAt(index), admissionDateAt(index));
+}
+
+void CompactPatientStore::reserve(size_t recordCount) {
+    records.reserve(recordCount);
+}
+
+void CompactPatientStore::clear() {
+    records.clear();
+    arena.clear();
+    strings.clear();
+}
+
+size_t CompactPatientStore::memoryUsage() const {
+    size_t bytes = records.capacity() * sizeof(CompactPatient) + arena.capacity();
+    for (uint32_t i = 0; i < strings.size(); i++) {
+        bytes += sizeof(string) + strings.get(i).capacity();
+    }
+    return bytes;
+}
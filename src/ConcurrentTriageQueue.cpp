@@ -0,0 +1,28 @@
+#include "../include/ConcurrentTriageQueue.h"
+
+using namespace std;
+
+ConcurrentTriageQueue::ConcurrentTriageQueue(size_t capacityPerLevel)
+    : critical(capacityPerLevel), urgent(capacityPerLevel), normal(capacityPerLevel) {}
+
+MpmcRing<Patient>* ConcurrentTriageQueue::ringFor(int priority) {
+    switch (priority) {
+        case 1: return &critical;
+        case 2: return &urgent;
+        case 3: return &normal;
+        default: return nullptr;
+    }
+}
+
+bool ConcurrentTriageQueue::enqueue(Patient patient) {
+    MpmcRing<Patient>* ring = ringFor(patient.priority);
+    return ring != nullptr && ring->tryPush(std::move(patient));
+}
+
+bool ConcurrentTriageQueue::tryDequeue(Patient& out) {
+    return critical.tryPop(out) || urgent.tryPop(out) || normal.tryPop(out);
+}
+
+size_t ConcurrentTriageQueue::approximateSize() const {
+    return critical.approximateSize() + urgent.approximateSize() + normal.approximateSize();
+}
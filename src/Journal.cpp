@@ -0,0 +1,473 @@
+#include "../include/Journal.h"
+#include "../include/Stats.h"
+#include "../include/Utils.h"
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+using namespace std;
+
+static const char JOURNAL_MAGIC[8] = {'M', 'F', 'J', 'O', 'U', 'R', 'N', 'L'};
+static const size_t JOURNAL_HEADER_SIZE = 16;
+static const size_t RECORD_OVERHEAD = 4 + 1 + 8 + 4;
+
+// --- payload encoding helpers ---
+
+static void putU32(string& out, uint32_t v) { out.append(reinterpret_cast<const char*>(&v), 4); }
+static void putU64(string& out, uint64_t v) { out.append(reinterpret_cast<const char*>(&v), 8); }
+static void putI32(string& out, int32_t v) { out.append(reinterpret_cast<const char*>(&v), 4); }
+
+static void putString(string& out, const string& s) {
+    putU32(out, static_cast<uint32_t>(s.size()));
+    out += s;
+}
+
+static void putPatient(string& out, const Patient& p) {
+    putString(out, p.id);
+    putString(out, p.name);
+    putI32(out, p.age);
+    putString(out, p.condition);
+    putI32(out, p.priority);
+    putString(out, p.admissionDate);
+}
+
+// Bounds-checked reader over one record's payload
+struct PayloadReader {
+    const char* p;
+    const char* end;
+    bool ok;
+
+    PayloadReader(const char* data, size_t length) : p(data), end(data + length), ok(true) {}
+
+    bool take(void* dst, size_t n) {
+        if (!ok || static_cast<size_t>(end - p) < n) {
+            ok = false;
+            return false;
+        }
+        memcpy(dst, p, n);
+        p += n;
+        return true;
+    }
+    int32_t i32() { int32_t v = 0; take(&v, 4); return v; }
+    string str() {
+        uint32_t n = 0;
+        if (!take(&n, 4) || static_cast<size_t>(end - p) < n) {
+            ok = false;
+            return string();
+        }
+        string s(p, n);
+        p += n;
+        return s;
+    }
+    Patient patient() {
+        string id = str();
+        string name = str();
+        int age = i32();
+        string condition = str();
+        int priority = i32();
+        string date = str();
+        return Patient(std::move(id), std::move(name), age, std::move(condition), priority, std::move(date));
+    }
+};
+
+static uint32_t checksum32(const char* data, size_t length) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static bool decodePayload(Journal::Entry& entry, const char* data, size_t length) {
+    PayloadReader in(data, length);
+    switch (entry.op) {
+        case Journal::LIST_INSERT:
+        case Journal::QUEUE_ENQUEUE:
+            entry.patient = in.patient();
+            break;
+        case Journal::LIST_UPDATE:
+            entry.id = in.str();
+            entry.patient = in.patient();
+            break;
+        case Journal::LIST_DELETE:
+        case Journal::QUEUE_DEQUEUE:
+        case Journal::QUEUE_REMOVE:
+            entry.id = in.str();
+            break;
+        case Journal::LIST_SORT:
+            entry.value = in.i32();
+            break;
+        case Journal::QUEUE_RETRIAGE:
+            entry.id = in.str();
+            entry.value = in.i32();
+            break;
+        case Journal::LIST_ORDER: {
+            int32_t n = in.i32();
+            for (int32_t i = 0; i < n && in.ok; i++) {
+                entry.ids.push_back(in.str());
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+    return in.ok && in.p == in.end;
+}
+
+static bool syncFile(FILE* f) {
+    if (fflush(f) != 0) return false;
+#ifndef _WIN32
+    if (fsync(fileno(f)) != 0) return false;
+#endif
+    return true;
+}
+
+static bool cutFile(FILE* f, size_t length) {
+#ifdef _WIN32
+    return _chsize_s(_fileno(f), static_cast<long long>(length)) == 0;
+#else
+    return ftruncate(fileno(f), static_cast<off_t>(length)) == 0;
+#endif
+}
+
+// The live segment is unbuffered: commit() hands stdio one block per group,
+// so a failed write never leaves half a group stuck in a FILE buffer
+static FILE* openLive(const string& path, const char* mode) {
+    FILE* f = fopen(path.c_str(), mode);
+    if (f != nullptr) setvbuf(f, nullptr, _IONBF, 0);
+    return f;
+}
+
+// --- Journal ---
+
+Journal::Journal()
+    : file(nullptr), lastLsn(0), pendingRecords(0), recordsInFile(0), failed(false),
+      groupCommitRecords(32), groupCommitDelayMs(200) {}
+
+Journal::~Journal() {
+    close();
+}
+
+void Journal::setGroupCommit(int records, int delayMs) {
+    groupCommitRecords = records < 1 ? 1 : records;
+    groupCommitDelayMs = delayMs < 0 ? 0 : delayMs;
+}
+
+bool Journal::writeHeader(FILE* out, uint64_t baseLsn) {
+    return fwrite(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC), 1, out) == 1 &&
+           fwrite(&baseLsn, sizeof(baseLsn), 1, out) == 1;
+}
+
+static bool readWholeFile(const string& filename, string& contents) {
+    FILE* in = fopen(filename.c_str(), "rb");
+    if (in == nullptr) {
+        return false;
+    }
+    char chunk[1 << 16];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+        contents.append(chunk, got);
+    }
+    fclose(in);
+    Stats::addBytesRead(contents.size());
+    return true;
+}
+
+// Replays the intact records of one journal segment and returns the offset
+// just past the last of them (0 if the header is missing or unrecognised).
+// Records at or below replayedThrough were already seen in an earlier
+// segment and are skipped.
+static size_t replaySegment(const string& contents, const function<void(const Journal::Entry&)>& onEntry,
+                            uint64_t& lastLsn, uint64_t& replayedThrough, long long& replayed) {
+    if (contents.size() < JOURNAL_HEADER_SIZE ||
+        memcmp(contents.data(), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) {
+        return 0;
+    }
+
+    uint64_t baseLsn;
+    memcpy(&baseLsn, contents.data() + 8, 8);
+    if (baseLsn > lastLsn) lastLsn = baseLsn;
+    size_t pos = JOURNAL_HEADER_SIZE;
+    size_t validEnd = pos;
+
+    while (contents.size() - pos >= RECORD_OVERHEAD) {
+        uint32_t payloadLength;
+        memcpy(&payloadLength, contents.data() + pos, 4);
+        if (contents.size() - pos - RECORD_OVERHEAD < payloadLength) break;   // Torn write
+
+        const char* body = contents.data() + pos + 4;           // op + lsn + payload
+        size_t bodyLength = 1 + 8 + payloadLength;
+        uint32_t stored;
+        memcpy(&stored, body + bodyLength, 4);
+        if (stored != checksum32(body, bodyLength)) break;
+
+        Journal::Entry entry;
+        entry.op = static_cast<Journal::Op>(static_cast<uint8_t>(body[0]));
+        memcpy(&entry.lsn, body + 1, 8);
+        if (!decodePayload(entry, body + 9, payloadLength)) break;
+
+        if (entry.lsn > replayedThrough) {
+            onEntry(entry);
+            replayedThrough = entry.lsn;
+            replayed++;
+        }
+        if (entry.lsn > lastLsn) lastLsn = entry.lsn;
+        pos += RECORD_OVERHEAD + payloadLength;
+        validEnd = pos;
+    }
+    return validEnd;
+}
+
+long long Journal::open(const string& journalPath, const function<void(const Entry&)>& onEntry,
+                        uint64_t minLsn) {
+    close();
+    path = journalPath;
+    lastLsn = minLsn;
+    recordsInFile = 0;
+
+    long long replayed = 0;
+    uint64_t replayedThrough = 0;
+
+    // A segment retired by rotate() whose checkpoint never finished comes first
+    string retired;
+    if (readWholeFile(retiredPath(), retired)) {
+        replaySegment(retired, onEntry, lastLsn, replayedThrough, replayed);
+    }
+
+    // Then whatever survived in the live segment from the previous run
+    string contents;
+    bool exists = readWholeFile(path, contents);
+    long long replayedBefore = replayed;
+    size_t validEnd = replaySegment(contents, onEntry, lastLsn, replayedThrough, replayed);
+
+    if (validEnd == 0) {
+        // A damaged or foreign file is kept for inspection, never overwritten
+        if (exists && !contents.empty()) {
+            string aside = path + ".corrupt";
+            for (int n = 1; Utils::fileExists(aside); n++) {
+                aside = path + ".corrupt." + to_string(n);
+            }
+            if (rename(path.c_str(), aside.c_str()) != 0) {
+                Utils::printError("Journal " + path + " is not a MediFlow journal and could not be moved aside.");
+                return -1;
+            }
+            Utils::printError("Journal " + path + " has an unrecognised header; moved to " + aside +
+                              " and started a new journal.");
+        }
+        file = openLive(path, "wb");
+        if (file == nullptr || !writeHeader(file, lastLsn) || !syncFile(file)) {
+            close();
+            return -1;
+        }
+    } else {
+        // Reopen and cut off any torn tail after the last intact record
+        file = openLive(path, "r+b");
+        if (file == nullptr) {
+            return -1;
+        }
+        if (validEnd < contents.size() && !cutFile(file, validEnd)) {
+            close();
+            return -1;
+        }
+        fseek(file, static_cast<long>(validEnd), SEEK_SET);
+    }
+
+    recordsInFile = replayed - replayedBefore;
+    return replayed;
+}
+
+void Journal::close() {
+    if (file != nullptr) {
+        commit();
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+void Journal::append(Op op, const string& payload) {
+    if (file == nullptr) return;
+
+    lastLsn++;
+    size_t start = buffer.size();
+    putU32(buffer, static_cast<uint32_t>(payload.size()));
+    buffer += static_cast<char>(op);
+    putU64(buffer, lastLsn);
+    buffer += payload;
+    putU32(buffer, checksum32(buffer.data() + start + 4, 1 + 8 + payload.size()));
+
+    if (pendingRecords == 0) {
+        firstPending = chrono::steady_clock::now();
+    }
+    pendingRecords++;
+    recordsInFile++;
+
+    // Group commit: one fsync covers every record buffered since the last one
+    if (pendingRecords >= groupCommitRecords ||
+        chrono::steady_clock::now() - firstPending >= chrono::milliseconds(groupCommitDelayMs)) {
+        commit();
+    }
+}
+
+bool Journal::commit() {
+    if (file == nullptr || pendingRecords == 0) return true;
+    long start = ftell(file);
+    bool written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size() && syncFile(file);
+    if (!written) {
+        // Keep the records for the next attempt and cut off any part that got through
+        string reason = strerror(errno);
+        clearerr(file);
+        if (start >= 0 && cutFile(file, static_cast<size_t>(start))) {
+            fseek(file, start, SEEK_SET);
+        }
+        if (!failed) {
+            Utils::printError("Journal write to " + path + " failed (" + reason + "). The last " +
+                              to_string(pendingRecords) + " change(s) are not durable yet; retrying.");
+        }
+        failed = true;
+        return false;
+    }
+    failed = false;
+    Stats::addBytesWritten(buffer.size());
+    buffer.clear();
+    pendingRecords = 0;
+    return true;
+}
+
+bool Journal::startFreshSegment() {
+    // Swap in an empty journal atomically: LSNs continue from lastLsn
+    string tempPath = path + ".tmp";
+    FILE* fresh = fopen(tempPath.c_str(), "wb");
+    if (fresh == nullptr || !writeHeader(fresh, lastLsn) || !syncFile(fresh)) {
+        if (fresh != nullptr) fclose(fresh);
+        remove(tempPath.c_str());
+        return false;
+    }
+    fclose(fresh);
+
+    if (file != nullptr) {
+        fclose(file);
+        file = nullptr;
+    }
+#ifdef _WIN32
+    remove(path.c_str());
+#endif
+    if (rename(tempPath.c_str(), path.c_str()) != 0) {
+        return false;
+    }
+    file = openLive(path, "ab");
+    recordsInFile = 0;
+    return file != nullptr;
+}
+
+bool Journal::truncate() {
+    if (file == nullptr || !commit()) return false;
+    if (!startFreshSegment()) {
+        return false;
+    }
+    discardRotated();   // Covered by the caller's snapshots as well
+    return true;
+}
+
+bool Journal::rotate() {
+    if (file == nullptr || !commit()) return false;
+
+    string retired = retiredPath();
+    FILE* existing = fopen(retired.c_str(), "rb");
+    if (existing == nullptr) {
+        // Usual case: the live segment simply becomes the retired one
+        fclose(file);
+        file = nullptr;
+        if (rename(path.c_str(), retired.c_str()) != 0) {
+            file = openLive(path, "ab");
+            return false;
+        }
+        return startFreshSegment();
+    }
+    fclose(existing);
+
+    // An earlier checkpoint failed: extend its retired segment instead.
+    // Replay skips any records a crash here leaves in both segments.
+    string contents;
+    if (!readWholeFile(path, contents) || contents.size() < JOURNAL_HEADER_SIZE) {
+        return false;
+    }
+    FILE* out = fopen(retired.c_str(), "ab");
+    if (out == nullptr) {
+        return false;
+    }
+    size_t recordBytes = contents.size() - JOURNAL_HEADER_SIZE;
+    bool ok = recordBytes == 0 ||
+              fwrite(contents.data() + JOURNAL_HEADER_SIZE, recordBytes, 1, out) == 1;
+    ok = syncFile(out) && ok;
+    ok = (fclose(out) == 0) && ok;
+    return ok && startFreshSegment();
+}
+
+void Journal::discardRotated() {
+    remove(retiredPath().c_str());
+}
+
+void Journal::logInsert(const Patient& p) {
+    string payload;
+    putPatient(payload, p);
+    append(LIST_INSERT, payload);
+}
+
+void Journal::logDelete(const string& id) {
+    string payload;
+    putString(payload, id);
+    append(LIST_DELETE, payload);
+}
+
+void Journal::logUpdate(const string& id, const Patient& p) {
+    string payload;
+    putString(payload, id);
+    putPatient(payload, p);
+    append(LIST_UPDATE, payload);
+}
+
+void Journal::logSort(int sortKey) {
+    string payload;
+    putI32(payload, sortKey);
+    append(LIST_SORT, payload);
+}
+
+void Journal::logOrder(const vector<string>& ids) {
+    string payload;
+    putI32(payload, static_cast<int32_t>(ids.size()));
+    for (const string& id : ids) {
+        putString(payload, id);
+    }
+    append(LIST_ORDER, payload);
+}
+
+void Journal::logEnqueue(const Patient& p) {
+    string payload;
+    putPatient(payload, p);
+    append(QUEUE_ENQUEUE, payload);
+}
+
+void Journal::logDequeue(const string& id) {
+    string payload;
+    putString(payload, id);
+    append(QUEUE_DEQUEUE, payload);
+}
+
+void Journal::logRemove(const string& id) {
+    string payload;
+    putString(payload, id);
+    append(QUEUE_REMOVE, payload);
+}
+
+void Journal::logRetriage(const string& id, int newPriority) {
+    string payload;
+    putString(payload, id);
+    putI32(payload, newPriority);
+    append(QUEUE_RETRIAGE, payload);
+}
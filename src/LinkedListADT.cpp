@@ -1,25 +1,60 @@
 #include "../include/LinkedListADT.h"
 #include "../include/Utils.h"
+#include "../include/PatientCsv.h"
+#include "../include/Snapshot.h"
+#include "../include/TableRenderer.h"
+#include "../include/Stats.h"
+#include <algorithm>
+#include <climits>
 #include <iostream>
-#include <fstream>
-#include <sstream>
+#include <thread>
 
 
 using namespace std;
 
-LinkedListADT::LinkedListADT() : head(nullptr), tail(nullptr), count(0) {}
+// Comparators for the built-in sort orders
+static bool byName(const Patient& a, const Patient& b) {
+    return a.name < b.name;
+}
+
+static bool byPriority(const Patient& a, const Patient& b) {
+    return a.priority < b.priority;
+}
+
+LinkedListADT::LinkedListADT()
+    : head(nullptr), tail(nullptr), count(0), journal(nullptr), snapshotLsn(0),
+      parallelSortThreshold(DEFAULT_PARALLEL_SORT_THRESHOLD), sortThreads(0) {}
 
 LinkedListADT::~LinkedListADT() {
     Node* current = head;
     while (current != nullptr) {
         Node* next = current->next;
-        delete current;
+        pool.destroy(current);
         current = next;
     }
 }
 
-void LinkedListADT::insertPatient(Patient p) {
-    Node* newNode = new Node(p);
+bool LinkedListADT::insertPatient(const Patient& p) {
+    Stats::Timer timer(Stats::LIST_INSERT);
+    return linkNode(pool.create(p));
+}
+
+bool LinkedListADT::insertPatient(Patient&& p) {
+    Stats::Timer timer(Stats::LIST_INSERT);
+    return linkNode(pool.create(std::move(p)));
+}
+
+bool LinkedListADT::linkNode(Node* newNode, bool verbose) {
+    const Patient& p = newNode->data;
+    if (!idIndex.insert(p.id, newNode)) {
+        if (verbose) {
+            Utils::printError("Patient ID " + p.id + " already exists. Record not added.");
+        }
+        pool.destroy(newNode);
+        return false;
+    }
+    nameIndex.add(newNode);
+    queryIndex.add(newNode);
 
     if (head == nullptr) {
         head = tail = newNode;
@@ -29,129 +64,345 @@ void LinkedListADT::insertPatient(Patient p) {
         tail = newNode;
     }
     count++;
-    cout << "Patient " << p.name << " added to records.\n";
+    if (journal) journal->logInsert(p);
+    if (verbose) {
+        cout << "Patient " << p.name << " added to records.\n";
+    }
+    return true;
 }
 
 bool LinkedListADT::deletePatient(const string& id) {
-    Node* current = head;
+    Stats::Timer timer(Stats::LIST_DELETE);
+    Node* const* found = idIndex.find(id);
+    if (found == nullptr) {
+        return false;
+    }
+    Node* current = *found;
 
-    while (current != nullptr) {
-        if (current->data.id == id) {
-            // Found the node to delete
-            if (current->prev != nullptr) {
-                current->prev->next = current->next;
-            } else {
-                head = current->next; // Deleting head
-            }
+    if (current->prev != nullptr) {
+        current->prev->next = current->next;
+    } else {
+        head = current->next; // Deleting head
+    }
 
-            if (current->next != nullptr) {
-                current->next->prev = current->prev;
-            } else {
-                tail = current->prev; // Deleting tail
-            }
+    if (current->next != nullptr) {
+        current->next->prev = current->prev;
+    } else {
+        tail = current->prev; // Deleting tail
+    }
+
+    if (journal) journal->logDelete(id);
+    idIndex.erase(id);
+    nameIndex.remove(current);
+    queryIndex.remove(current);
+    pool.destroy(current);
+    count--;
+    return true;
+}
 
-            delete current;
-            count--;
-            return true;
+bool LinkedListADT::updatePatient(const string& id, const Patient& newData) {
+    return updatePatient(id, Patient(newData));
+}
+
+bool LinkedListADT::updatePatient(const string& id, Patient&& newData) {
+    Stats::Timer timer(Stats::LIST_UPDATE);
+    Node* const* found = idIndex.find(id);
+    if (found == nullptr) {
+        return false;
+    }
+    Node* node = *found;
+
+    // Re-key the index if the ID itself is being changed
+    if (newData.id != id) {
+        if (idIndex.contains(newData.id)) {
+            Utils::printError("Patient ID " + newData.id + " already exists. Record not updated.");
+            return false;
         }
-        current = current->next;
+        idIndex.erase(id);
+        idIndex.insert(newData.id, node);
     }
-    return false;
+
+    bool renamed = (newData.name != node->data.name);
+    if (renamed) nameIndex.remove(node);
+    queryIndex.remove(node);
+    node->data = std::move(newData);
+    if (renamed) nameIndex.add(node);
+    queryIndex.add(node);
+    if (journal) journal->logUpdate(id, node->data);
+    return true;
 }
 
-bool LinkedListADT::updatePatient(const string& id, Patient newData) {
-    Node* node = searchByID(id);
-    if (node != nullptr) {
-        node->data = newData;
+Node* LinkedListADT::searchByID(const string& id) const {
+    Stats::Timer timer(Stats::LIST_SEARCH_ID);
+    // Hash index lookup - O(1) average
+    Node* const* found = idIndex.find(id);
+    return found != nullptr ? *found : nullptr;
+}
+
+Node* LinkedListADT::searchByName(const string& name) const {
+    Stats::Timer timer(Stats::LIST_SEARCH_NAME);
+    vector<Node*> matches = nameIndex.findExact(name);
+    return matches.empty() ? nullptr : matches.front();
+}
+
+vector<Node*> LinkedListADT::searchByNamePrefix(const string& prefix) const {
+    Stats::Timer timer(Stats::LIST_SEARCH_PREFIX);
+    return nameIndex.findPrefix(prefix);
+}
+
+vector<Node*> LinkedListADT::query(const PatientQuery& q, string* plan) const {
+    Stats::Timer timer(Stats::LIST_QUERY);
+    vector<Node*> results;
+    queryIndex.run(q, [&results](Node* node) {
+        results.push_back(node);
         return true;
+    }, plan);
+    return results;
+}
+
+size_t LinkedListADT::forEachMatch(const PatientQuery& q, const QueryIndex::Visitor& visit) const {
+    Stats::Timer timer(Stats::LIST_QUERY);
+    return queryIndex.run(q, visit);
+}
+
+vector<Node*> LinkedListADT::admittedBetween(int fromDay, int toDay, size_t limit) const {
+    Stats::Timer timer(Stats::LIST_ADMISSIONS);
+    vector<Node*> results;
+    queryIndex.walkDays(fromDay, toDay, false, limit, [&results](Node* node) {
+        results.push_back(node);
+        return true;
+    });
+    return results;
+}
+
+vector<Node*> LinkedListADT::mostRecentAdmissions(size_t n) const {
+    Stats::Timer timer(Stats::LIST_ADMISSIONS);
+    vector<Node*> results;
+    if (n == 0) return results;
+    queryIndex.walkDays(INT_MIN, INT_MAX, true, n, [&results](Node* node) {
+        results.push_back(node);
+        return true;
+    });
+    return results;
+}
+
+vector<pair<int, size_t>> LinkedListADT::dailyAdmissions(int fromDay, int toDay) const {
+    Stats::Timer timer(Stats::LIST_ADMISSIONS);
+    return queryIndex.dailyCounts(fromDay, toDay);
+}
+
+void LinkedListADT::sortByName() {
+    if (head == nullptr || head->next == nullptr) {
+        cout << "[INFO] List has 0 or 1 patient. No sorting needed.\n";
+        return;
     }
-    return false;
+
+    mergeSort(byName);
+    if (journal) journal->logSort(SORT_BY_NAME);
+
+    cout << "[SUCCESS] Patients sorted by name (A-Z).\n";
 }
 
-Node* LinkedListADT::searchByID(const string& id) const {
-    Node* current = head;
-    while (current != nullptr) {
-        if (current->data.id == id) {
-            return current;
+void LinkedListADT::sortByPriority() {
+    if (head == nullptr || head->next == nullptr) {
+        cout << "[INFO] List has 0 or 1 patient. No sorting needed.\n";
+        return;
+    }
+
+    // 1=Critical first, 2=Urgent, 3=Normal; stable, so equal priorities keep their order
+    mergeSort(byPriority);
+    if (journal) journal->logSort(SORT_BY_PRIORITY);
+
+    cout << "[SUCCESS] Patients sorted by priority (Critical -> Urgent -> Normal).\n";
+}
+
+// Detaches the non-descending run starting at 'start' and returns the node after it
+Node* LinkedListADT::splitRun(Node* start, const PatientComparator& less) {
+    Node* last = start;
+    while (last->next != nullptr && !less(last->next->data, last->data)) {
+        last = last->next;
+    }
+    Node* rest = last->next;
+    last->next = nullptr;
+    return rest;
+}
+
+// Merges two sorted runs (next pointers only). Ties take from 'a' to stay stable.
+Node* LinkedListADT::mergeRuns(Node* a, Node* b, const PatientComparator& less, Node*& mergedTail) {
+    Node dummy{Patient()};
+    Node* last = &dummy;
+
+    while (a != nullptr && b != nullptr) {
+        if (less(b->data, a->data)) {
+            last->next = b;
+            b = b->next;
+        } else {
+            last->next = a;
+            a = a->next;
         }
-        current = current->next;
+        last = last->next;
     }
-    return nullptr;
+    last->next = (a != nullptr) ? a : b;
+    while (last->next != nullptr) {
+        last = last->next;
+    }
+
+    mergedTail = last;
+    return dummy.next;
 }
 
-Node* LinkedListADT::searchByName(const string& name) const {
-    Node* current = head;
-    while (current != nullptr) {
-        if (current->data.name == name) {
-            return current;
+void LinkedListADT::sortBy(const PatientComparator& less) {
+    mergeSort(less);
+
+    // An arbitrary comparator cannot be replayed, so journal the resulting order
+    if (journal && count > 1) {
+        vector<string> ids;
+        ids.reserve(count);
+        for (Node* current = head; current != nullptr; current = current->next) {
+            ids.push_back(current->data.id);
         }
-        current = current->next;
+        journal->logOrder(ids);
     }
-    return nullptr;
 }
 
-void LinkedListADT::sortByName() {
-    if (head == nullptr || head->next == nullptr) {
-        cout << "[INFO] List has 0 or 1 patient. No sorting needed.\n";
-        return;
+bool LinkedListADT::triageOrder(const Patient& a, const Patient& b) {
+    if (a.priority != b.priority) return a.priority < b.priority;
+    if (a.admissionDate != b.admissionDate) return a.admissionDate < b.admissionDate;
+    return a.name < b.name;
+}
+
+void LinkedListADT::setParallelSort(int threshold, int threads) {
+    parallelSortThreshold = threshold;
+    sortThreads = threads;
+}
+
+// Runs work(0..tasks-1), one task per thread; the caller's thread takes the last
+template <typename Work>
+static void forkJoin(int tasks, const Work& work) {
+    vector<thread> helpers;
+    helpers.reserve(tasks - 1);
+    for (int i = 0; i < tasks - 1; i++) {
+        helpers.emplace_back([&work, i] { work(i); });
+    }
+    work(tasks - 1);
+    for (thread& helper : helpers) {
+        helper.join();
     }
+}
 
-    // Bubble Sort by Name (ascending order)
-    bool swapped;
-    Node* current;
-    Node* last = nullptr;
+void LinkedListADT::parallelSort(const PatientComparator& less) {
+    const size_t MIN_CHUNK = 16384;     // Smaller chunks cost more in threads than they save
 
-    do {
-        swapped = false;
-        current = head;
+    vector<Node*> nodes;
+    nodes.reserve(count);
+    for (Node* current = head; current != nullptr; current = current->next) {
+        nodes.push_back(current);
+    }
+    auto nodeLess = [&less](const Node* a, const Node* b) { return less(a->data, b->data); };
 
-        while (current->next != last) {
-            // Compare current name with next name
-            if (current->data.name > current->next->data.name) {
-                // Swap the patient data
-                Patient temp = current->data;
-                current->data = current->next->data;
-                current->next->data = temp;
-                swapped = true;
-            }
-            current = current->next;
+    // Already in order (e.g. sorted twice): the merge sort would stop after one pass too
+    if (is_sorted(nodes.begin(), nodes.end(), nodeLess)) {
+        return;
+    }
+
+    int threads = (sortThreads > 0) ? sortThreads : static_cast<int>(thread::hardware_concurrency());
+    size_t maxChunks = max<size_t>(1, nodes.size() / MIN_CHUNK);
+    threads = static_cast<int>(min<size_t>(max(threads, 1), maxChunks));
+
+    // Stable-sort equal chunks side by side...
+    vector<size_t> bounds(threads + 1);
+    for (int i = 0; i <= threads; i++) {
+        bounds[i] = nodes.size() * i / threads;
+    }
+    forkJoin(threads, [&](int i) {
+        stable_sort(nodes.begin() + bounds[i], nodes.begin() + bounds[i + 1], nodeLess);
+    });
+
+    // ...then merge neighbouring chunks pairwise, all pairs of a round at once.
+    // std::merge takes ties from the left chunk, so the result stays stable.
+    vector<Node*> buffer(nodes.size());
+    vector<Node*>* from = &nodes;
+    vector<Node*>* to = &buffer;
+    while (bounds.size() > 2) {
+        size_t runs = bounds.size() - 1;
+        vector<size_t> mergedBounds;
+        for (size_t i = 0; i < runs; i += 2) {
+            mergedBounds.push_back(bounds[i]);
         }
-        last = current;
-    } while (swapped);
+        mergedBounds.push_back(bounds.back());
+
+        forkJoin(static_cast<int>((runs + 1) / 2), [&](int pair) {
+            size_t lo = bounds[2 * pair];
+            size_t mid = bounds[min<size_t>(2 * pair + 1, runs)];
+            size_t hi = bounds[min<size_t>(2 * pair + 2, runs)];    // Odd one out is copied
+            merge(from->begin() + lo, from->begin() + mid, from->begin() + mid, from->begin() + hi,
+                  to->begin() + lo, nodeLess);
+        });
+        swap(from, to);
+        bounds.swap(mergedBounds);
+    }
 
-    cout << "[SUCCESS] Patients sorted by name (A-Z).\n";
+    // Relink in one pass
+    Node* previous = nullptr;
+    for (Node* current : *from) {
+        current->prev = previous;
+        if (previous != nullptr) previous->next = current;
+        previous = current;
+    }
+    previous->next = nullptr;
+    head = from->front();
+    tail = previous;
 }
 
-void LinkedListADT::sortByPriority() {
+void LinkedListADT::mergeSort(const PatientComparator& less) {
     if (head == nullptr || head->next == nullptr) {
-        cout << "[INFO] List has 0 or 1 patient. No sorting needed.\n";
+        return;
+    }
+    Stats::Timer timer(Stats::LIST_SORT);
+
+    if (count >= parallelSortThreshold) {
+        parallelSort(less);
         return;
     }
 
-    // Bubble Sort by Priority (1=Critical first, 2=Urgent, 3=Normal)
-    bool swapped;
-    Node* current;
-    Node* last = nullptr;
+    // Natural merge sort: each pass merges neighbouring ascending runs pairwise,
+    // so already-sorted input finishes in one O(n) pass. Only pointers move.
+    while (true) {
+        Node* sorted = nullptr;
+        Node* sortedTail = nullptr;
+        Node* rest = head;
+        int merges = 0;
 
-    do {
-        swapped = false;
-        current = head;
+        while (rest != nullptr) {
+            Node* a = rest;
+            Node* b = splitRun(a, less);
+            rest = (b != nullptr) ? splitRun(b, less) : nullptr;
 
-        while (current->next != last) {
-            // Lower priority number = higher urgency (1 > 2 > 3)
-            if (current->data.priority > current->next->data.priority) {
-                // Swap the patient data
-                Patient temp = current->data;
-                current->data = current->next->data;
-                current->next->data = temp;
-                swapped = true;
+            Node* mergedTail = nullptr;
+            Node* merged = mergeRuns(a, b, less, mergedTail);
+
+            if (sorted == nullptr) {
+                sorted = merged;
+            } else {
+                sortedTail->next = merged;
             }
-            current = current->next;
+            sortedTail = mergedTail;
+            merges++;
         }
-        last = current;
-    } while (swapped);
 
-    cout << "[SUCCESS] Patients sorted by priority (Critical -> Urgent -> Normal).\n";
+        head = sorted;
+        if (merges == 1) {
+            break;
+        }
+    }
+
+    // Restore the backward links and tail so displayReverse keeps working
+    Node* previous = nullptr;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        current->prev = previous;
+        previous = current;
+    }
+    tail = previous;
 }
 
 void LinkedListADT::displayAll() const {
@@ -160,39 +411,32 @@ void LinkedListADT::displayAll() const {
         return;
     }
 
-    Node* current = head;
+    // Whole table is built in one buffer and written at once
+    TableRenderer table;
+    table.setColumns({{"ID", 8}, {"Name", 25}, {"Age", 5}, {"Priority", 10}, {"Condition", 0}});
+    table.reserveRows(count);
 
     // Top border
-    cout << "\n" << string(90, '=') << "\n";
-    cout << "  ALL PATIENT RECORDS\n";
-    cout << string(90, '=') << "\n";
+    table.text("\n");
+    table.rule('=', 90);
+    table.text("  ALL PATIENT RECORDS\n");
+    table.rule('=', 90);
 
-    // Header row
-    cout << left
-         << setw(8) << "ID" << " | "
-         << setw(25) << "Name" << " | "
-         << setw(5) << "Age" << " | "
-         << setw(10) << "Priority" << " | "
-         << "Condition\n";
-
-    // Separator line
-    cout << string(90, '-') << "\n";
+    // Header row and separator line
+    table.header();
+    table.rule('-', 90);
 
     // Data rows
-    while (current != nullptr) {
-        cout << left
-             << setw(8) << current->data.id << " | "
-             << setw(25) << current->data.name << " | "
-             << setw(5) << current->data.age << " | "
-             << setw(10) << current->data.priority << " | "
-             << current->data.condition << "\n";
-
-        current = current->next;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        table.cell(current->data.id).cell(current->data.name).cell(current->data.age)
+             .cell(current->data.priority).cell(current->data.condition);
+        table.endRow();
     }
 
     // Bottom border
-    cout << string(90, '-') << "\n";
-    cout << "Total patients: " << count << "\n\n";
+    table.rule('-', 90);
+    table.text("Total patients: " + to_string(count) + "\n\n");
+    table.flush();
 }
 void LinkedListADT::displayReverse() const {
     if (tail == nullptr) {
@@ -200,71 +444,248 @@ void LinkedListADT::displayReverse() const {
         return;
     }
 
-    Node* current = tail;
-    cout << "\n=== PATIENT RECORDS (REVERSE) ===\n";
+    TableRenderer table;
+    table.reserveRows(count);
+    table.text("\n=== PATIENT RECORDS (REVERSE) ===\n");
 
-    while (current != nullptr) {
-        cout << current->data.id << " | "
-             << current->data.name << " | "
-             << current->data.age << "  | "
-             << current->data.priority << "\n";
-        current = current->prev;
+    for (Node* current = tail; current != nullptr; current = current->prev) {
+        table.text(current->data.id + " | " + current->data.name + " | " +
+                   to_string(current->data.age) + "  | " + to_string(current->data.priority) + "\n");
+    }
+    table.flush();
+}
+
+LinkedListADT::PageCursor LinkedListADT::firstPage() const {
+    return PageCursor{head, 0};
+}
+
+LinkedListADT::PageCursor LinkedListADT::lastPage(int pageSize) const {
+    if (tail == nullptr || pageSize <= 0) {
+        return firstPage();
+    }
+    // Walk back from the tail to the start of the last full page boundary
+    long long start = ((count - 1) / pageSize) * static_cast<long long>(pageSize);
+    Node* first = tail;
+    for (long long i = count - 1; i > start; i--) {
+        first = first->prev;
+    }
+    return PageCursor{first, start};
+}
+
+LinkedListADT::PageCursor LinkedListADT::nextPage(const PageCursor& page, int pageSize) const {
+    if (pageSize <= 0) return page;
+    Node* first = page.first;
+    for (int i = 0; i < pageSize && first != nullptr; i++) {
+        first = first->next;
+    }
+    if (first == nullptr) {
+        return page;   // Already on the last page
+    }
+    return PageCursor{first, page.index < 0 ? -1 : page.index + pageSize};
+}
+
+LinkedListADT::PageCursor LinkedListADT::prevPage(const PageCursor& page, int pageSize) const {
+    if (pageSize <= 0) return page;
+    Node* first = page.first;
+    int moved = 0;
+    while (moved < pageSize && first != nullptr && first->prev != nullptr) {
+        first = first->prev;
+        moved++;
+    }
+    if (first != nullptr && first->prev == nullptr) {
+        return firstPage();   // Reached the head, so the position is known again
     }
+    return PageCursor{first, page.index < 0 ? -1 : page.index - moved};
 }
 
-void LinkedListADT::saveToFile(const string& filename) const {
-    ofstream file(filename);
-    if (!file.is_open()) {
-        Utils::printError("Cannot open file for writing: " + filename);
+LinkedListADT::PageCursor LinkedListADT::jumpToPage(long long pageNumber, int pageSize) const {
+    if (pageSize <= 0) return firstPage();
+    long long lastNumber = (count == 0) ? 1 : (count - 1) / pageSize + 1;
+    if (pageNumber <= 1) return firstPage();
+    if (pageNumber >= lastNumber) return lastPage(pageSize);
+
+    long long target = (pageNumber - 1) * pageSize;
+    Node* first;
+    if (target <= count / 2) {
+        first = head;
+        for (long long i = 0; i < target; i++) first = first->next;
+    } else {
+        first = tail;
+        for (long long i = count - 1; i > target; i--) first = first->prev;
+    }
+    return PageCursor{first, target};
+}
+
+bool LinkedListADT::pageFromID(const string& id, PageCursor& page) const {
+    Node* node = searchByID(id);
+    if (node == nullptr) {
+        return false;
+    }
+    page = (node == head) ? firstPage() : PageCursor{node, -1};
+    return true;
+}
+
+vector<const Patient*> LinkedListADT::pageRecords(const PageCursor& page, int pageSize) const {
+    vector<const Patient*> records;
+    if (pageSize <= 0) return records;
+    records.reserve(pageSize);
+    for (Node* current = page.first; current != nullptr && static_cast<int>(records.size()) < pageSize;
+         current = current->next) {
+        records.push_back(&current->data);
+    }
+    return records;
+}
+
+void LinkedListADT::displayPage(const PageCursor& page, int pageSize) const {
+    if (pageSize <= 0) {
+        Utils::printError("Page size must be at least 1.");
+        return;
+    }
+    if (page.first == nullptr) {
+        cout << "No patient records found.\n";
         return;
     }
 
-    Node* current = head;
-    while (current != nullptr) {
-        file << current->data.id << ","
-             << current->data.name << ","
-             << current->data.age << ","
-             << current->data.condition << ","
-             << current->data.priority << ","
-             << current->data.admissionDate << "\n";
-        current = current->next;
+    TableRenderer table;
+    table.setColumns({{"ID", 8}, {"Name", 25}, {"Age", 5}, {"Priority", 10}, {"Condition", 0}});
+    table.reserveRows(pageSize);
+
+    table.text("\n");
+    table.rule('=', 90);
+    table.text("  ALL PATIENT RECORDS\n");
+    table.rule('=', 90);
+    table.header();
+    table.rule('-', 90);
+
+    int shown = 0;
+    for (Node* current = page.first; current != nullptr && shown < pageSize; current = current->next) {
+        table.cell(current->data.id).cell(current->data.name).cell(current->data.age)
+             .cell(current->data.priority).cell(current->data.condition);
+        table.endRow();
+        shown++;
     }
 
-    file.close();
+    table.rule('-', 90);
+    if (page.index >= 0) {
+        long long pages = (count - 1) / pageSize + 1;
+        table.text("Page " + to_string(page.index / pageSize + 1) + " of " + to_string(pages) +
+                   "  (records " + to_string(page.index + 1) + "-" + to_string(page.index + shown) +
+                   " of " + to_string(count) + ")\n\n");
+    } else {
+        table.text(to_string(shown) + " records from " + page.first->data.id +
+                   " (total patients: " + to_string(count) + ")\n\n");
+    }
+    table.flush();
+}
+
+bool LinkedListADT::saveToFile(const string& filename) const {
+    Stats::Timer timer(Stats::LIST_SAVE);
+    // Both formats go through a temp file + fsync + rename, so a failed
+    // save leaves the previous file intact
+    CompactPatientStore store;
+    archiveTo(store);
+    uint64_t lsn = journal ? journal->getLastLsn() : 0;
+    bool saved = Snapshot::isSnapshotFile(filename)
+                 ? Snapshot::write(filename, Snapshot::PATIENT_RECORDS, store, lsn)
+                 : PatientCsv::write(filename, store, lsn);
+    if (!saved) {
+        Utils::printError("Cannot write " + filename);
+        return false;
+    }
     cout << "[INFO] " << count << " patient records saved to " << filename << "\n";
+    return true;
 }
 
 void LinkedListADT::loadFromFile(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+    Stats::Timer timer(Stats::LIST_LOAD);
+    // Bulk path: block reads, in-place field splitting, no per-record output
+    // (binary snapshots stream through the same callback). Loaded records
+    // are already durable, so they are not journaled.
+    Journal* attached = journal;
+    journal = nullptr;
+    snapshotLsn = 0;
+
+    PatientCsv::LoadReport report;
+    auto onRecord = [this](const PatientCsv::Record& rec) {
+        Node* node = pool.create(std::in_place, string(rec.id), string(rec.name), rec.age,
+                                 string(rec.condition), rec.priority, string(rec.admissionDate));
+        return linkNode(node, false);
+    };
+    bool opened = Snapshot::isSnapshotFile(filename)
+                  ? Snapshot::load(filename, Snapshot::PATIENT_RECORDS, onRecord, report, &snapshotLsn)
+                  : PatientCsv::load(filename, onRecord, report, &snapshotLsn);
+    journal = attached;
+
+    if (!opened) {
         cout << "[INFO] No existing patient records found. Starting fresh.\n";
         return;
     }
+    PatientCsv::printSummary(report, "patient records", filename);
+    if (queryIndex.undatedCount() > 0) {
+        cout << "[INFO] " << queryIndex.undatedCount() << " patient record(s) have no valid "
+             << "YYYY-MM-DD admission date and are left out of date searches.\n";
+    }
+}
 
-    string line;
-    int loaded = 0;
+void LinkedListADT::archiveTo(CompactPatientStore& store) const {
+    store.reserve(store.size() + count);
+    for (Node* current = head; current != nullptr; current = current->next) {
+        store.append(current->data);
+    }
+}
 
-    while (getline(file, line)) {
-        if (line.empty()) continue;
+void LinkedListADT::reorder(const vector<string>& ids) {
+    // Listed nodes first in the given order, then any others in their current order
+    HashIndex<bool> placed(ids.size() * 2);
+    Node* newHead = nullptr;
+    Node* newTail = nullptr;
+
+    auto append = [&](Node* node) {
+        node->prev = newTail;
+        node->next = nullptr;
+        if (newTail == nullptr) newHead = node; else newTail->next = node;
+        newTail = node;
+    };
+
+    vector<Node*> listed;
+    listed.reserve(ids.size());
+    for (const string& id : ids) {
+        Node* node = searchByID(id);
+        if (node != nullptr && placed.insert(id, true)) {
+            listed.push_back(node);
+        }
+    }
 
-        stringstream ss(line);
-        string id, name, condition, date;
-        int age, priority;
+    Node* current = head;
+    for (Node* node : listed) append(node);
+    while (current != nullptr) {
+        Node* next = current->next;
+        if (!placed.contains(current->data.id)) append(current);
+        current = next;
+    }
 
-        getline(ss, id, ',');
-        getline(ss, name, ',');
-        ss >> age;
-        ss.ignore(); // Skip comma
-        getline(ss, condition, ',');
-        ss >> priority;
-        ss.ignore(); // Skip comma
-        getline(ss, date);
+    head = newHead;
+    tail = newTail;
+}
 
-        Patient p(id, name, age, condition, priority, date);
-        insertPatient(p);
-        loaded++;
+void LinkedListADT::applyJournalEntry(const Journal::Entry& entry) {
+    switch (entry.op) {
+        case Journal::LIST_INSERT:
+            linkNode(pool.create(entry.patient), false);
+            break;
+        case Journal::LIST_DELETE:
+            deletePatient(entry.id);
+            break;
+        case Journal::LIST_UPDATE:
+            updatePatient(entry.id, entry.patient);
+            break;
+        case Journal::LIST_SORT:
+            mergeSort(entry.value == SORT_BY_NAME ? byName : byPriority);
+            break;
+        case Journal::LIST_ORDER:
+            reorder(entry.ids);
+            break;
+        default:
+            break;   // Queue operations are not ours
     }
-
-    file.close();
-    cout << "[INFO] Loaded " << loaded << " patient records from " << filename << "\n";
-}
\ No newline at end of file
+}
@@ -0,0 +1,65 @@
+#include "../include/NameIndex.h"
+#include <cctype>
+
+using namespace std;
+
+string NameIndex::normalize(const string& name) {
+    string key;
+    key.reserve(name.size());
+
+    bool pendingSpace = false;
+    for (unsigned char c : name) {
+        if (isspace(c)) {
+            pendingSpace = !key.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            key += ' ';
+            pendingSpace = false;
+        }
+        key += static_cast<char>(tolower(c));
+    }
+    return key;
+}
+
+void NameIndex::add(Node* node) {
+    entries.emplace(normalize(node->data.name), node);
+}
+
+void NameIndex::remove(Node* node) {
+    auto range = entries.equal_range(normalize(node->data.name));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == node) {
+            entries.erase(it);
+            return;
+        }
+    }
+}
+
+void NameIndex::clear() {
+    entries.clear();
+}
+
+vector<Node*> NameIndex::findExact(const string& name) const {
+    vector<Node*> results;
+    auto range = entries.equal_range(normalize(name));
+    for (auto it = range.first; it != range.second; ++it) {
+        results.push_back(it->second);
+    }
+    return results;
+}
+
+vector<Node*> NameIndex::findPrefix(const string& prefix) const {
+    vector<Node*> results;
+    string key = normalize(prefix);
+
+    // Every key starting with the prefix sorts at or after lower_bound(prefix)
+    // and the run ends at the first key that no longer shares the prefix
+    for (auto it = entries.lower_bound(key); it != entries.end(); ++it) {
+        if (it->first.compare(0, key.size(), key) != 0) {
+            break;
+        }
+        results.push_back(it->second);
+    }
+    return results;
+}
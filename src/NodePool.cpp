@@ -0,0 +1,65 @@
+#include "../include/NodePool.h"
+
+using namespace std;
+
+// A slot must be able to hold either a Node or a free-list link
+static const size_t SLOT_SIZE = sizeof(Node) > sizeof(void*) ? sizeof(Node) : sizeof(void*);
+
+NodePool::NodePool()
+    : freeList(nullptr), bumpNext(nullptr), bumpEnd(nullptr),
+      nextSlabNodes(FIRST_SLAB_NODES), liveNodes(0), bytesReserved(0) {}
+
+NodePool::~NodePool() {
+    // Bulk release: owners destroy their live nodes first, the memory
+    // itself goes back slab by slab rather than node by node
+    for (void* slab : slabs) {
+        ::operator delete(slab);
+    }
+}
+
+void* NodePool::allocate() {
+    void* slot;
+
+    if (freeList != nullptr) {
+        slot = freeList;
+        freeList = freeList->next;
+    } else {
+        if (bumpNext == bumpEnd) {
+            size_t bytes = nextSlabNodes * SLOT_SIZE;
+            char* slab = static_cast<char*>(::operator new(bytes));
+            slabs.push_back(slab);
+            bytesReserved += bytes;
+            bumpNext = slab;
+            bumpEnd = slab + bytes;
+            if (nextSlabNodes < MAX_SLAB_NODES) {
+                nextSlabNodes *= 2;
+            }
+        }
+        slot = bumpNext;
+        bumpNext += SLOT_SIZE;
+    }
+
+    liveNodes++;
+    return slot;
+}
+
+void NodePool::deallocate(void* slot) {
+    FreeSlot* freed = static_cast<FreeSlot*>(slot);
+    freed->next = freeList;
+    freeList = freed;
+    liveNodes--;
+}
+
+void NodePool::destroy(Node* node) {
+    if (node == nullptr) return;
+    node->~Node();
+    deallocate(node);
+}
+
+NodePool::Stats NodePool::getStats() const {
+    Stats stats;
+    stats.liveNodes = liveNodes;
+    stats.slabs = slabs.size();
+    stats.bytesReserved = bytesReserved;
+    return stats;
+}
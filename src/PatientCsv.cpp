@@ -0,0 +1,260 @@
+#include "../include/PatientCsv.h"
+#include "../include/Stats.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+#ifndef _WIN32
+    #include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace PatientCsv {
+
+    static const size_t BLOCK_SIZE = 1 << 20;   // 1 MiB reads
+    static const string_view LSN_PREFIX = "# journal-lsn ";
+
+    static bool parseInt(string_view text, int& value) {
+        size_t i = 0, n = text.size();
+        while (i < n && (text[i] == ' ' || text[i] == '\t')) i++;
+        while (n > i && (text[n - 1] == ' ' || text[n - 1] == '\t')) n--;
+
+        bool negative = false;
+        if (i < n && (text[i] == '-' || text[i] == '+')) {
+            negative = (text[i] == '-');
+            i++;
+        }
+        if (i == n || n - i > 9) return false;
+
+        int result = 0;
+        for (; i < n; i++) {
+            if (text[i] < '0' || text[i] > '9') return false;
+            result = result * 10 + (text[i] - '0');
+        }
+        value = negative ? -result : result;
+        return true;
+    }
+
+    static void addProblem(LoadReport& report, long long lineNumber, const string& message) {
+        if (report.problems.size() < MAX_PROBLEMS) {
+            report.problems.push_back("line " + to_string(lineNumber) + ": " + message);
+        }
+    }
+
+    bool parseRecord(string_view line, Record& rec, string& problem) {
+        // First five commas delimit the fields; the date is the rest of the line
+        string_view fields[6];
+        size_t start = 0;
+        for (int f = 0; f < 5; f++) {
+            size_t comma = line.find(',', start);
+            if (comma == string_view::npos) {
+                problem = "expected 6 fields, found " + to_string(f + 1);
+                return false;
+            }
+            fields[f] = line.substr(start, comma - start);
+            start = comma + 1;
+        }
+        fields[5] = line.substr(start);
+
+        rec.id = fields[0];
+        rec.name = fields[1];
+        rec.condition = fields[3];
+        rec.admissionDate = fields[5];
+
+        if (rec.id.empty()) {
+            problem = "missing patient ID";
+            return false;
+        }
+        if (!parseInt(fields[2], rec.age)) {
+            problem = "invalid age '" + string(fields[2]) + "'";
+            return false;
+        }
+        if (!parseInt(fields[4], rec.priority)) {
+            problem = "invalid priority '" + string(fields[4]) + "'";
+            return false;
+        }
+        return checkRecord(rec, problem);
+    }
+
+    bool checkRecord(const Record& rec, string& problem) {
+        if (rec.id.empty()) {
+            problem = "missing patient ID";
+            return false;
+        }
+        if (rec.age < 0 || rec.age > 150) {
+            problem = "invalid age '" + to_string(rec.age) + "'";
+            return false;
+        }
+        if (rec.priority < 1 || rec.priority > 3) {
+            problem = "invalid priority '" + to_string(rec.priority) + "'";
+            return false;
+        }
+        return true;
+    }
+
+    string lsnHeader(uint64_t journalLsn) {
+        if (journalLsn == 0) return "";
+        return string(LSN_PREFIX) + to_string(journalLsn) + "\n";
+    }
+
+    static bool parseLsn(string_view text, uint64_t& lsn) {
+        if (text.empty() || text.size() > 19) return false;
+        uint64_t value = 0;
+        for (char c : text) {
+            if (c < '0' || c > '9') return false;
+            value = value * 10 + static_cast<uint64_t>(c - '0');
+        }
+        lsn = value;
+        return true;
+    }
+
+    // Splits one line (without its newline) and hands it to onRecord
+    static void parseLine(string_view line, long long lineNumber,
+                          const function<bool(const Record&)>& onRecord, LoadReport& report,
+                          uint64_t* journalLsn) {
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty()) return;
+
+        if (lineNumber == 1 && line.substr(0, LSN_PREFIX.size()) == LSN_PREFIX) {
+            uint64_t lsn;
+            if (!parseLsn(line.substr(LSN_PREFIX.size()), lsn)) {
+                report.malformed++;
+                addProblem(report, lineNumber, "invalid journal LSN header");
+            } else if (journalLsn != nullptr) {
+                *journalLsn = lsn;
+            }
+            return;
+        }
+
+        Record rec;
+        rec.lineNumber = lineNumber;
+        string problem;
+        if (!parseRecord(line, rec, problem)) {
+            report.malformed++;
+            addProblem(report, lineNumber, problem);
+            return;
+        }
+
+        if (onRecord(rec)) {
+            report.loaded++;
+        } else {
+            report.rejected++;
+            addProblem(report, lineNumber, "duplicate ID " + string(rec.id) + " skipped");
+        }
+    }
+
+    bool load(const string& filename, const function<bool(const Record&)>& onRecord, LoadReport& report,
+              uint64_t* journalLsn) {
+        if (journalLsn != nullptr) *journalLsn = 0;
+        FILE* file = fopen(filename.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        // Lines are split inside the buffer; a partial line at the end of a
+        // block is moved to the front and completed by the next read
+        vector<char> buffer(BLOCK_SIZE);
+        size_t carry = 0;
+        long long lineNumber = 0;
+        uint64_t totalRead = 0;
+
+        while (true) {
+            if (carry == buffer.size()) {
+                buffer.resize(buffer.size() * 2);   // Line longer than the buffer
+            }
+            size_t got = fread(buffer.data() + carry, 1, buffer.size() - carry, file);
+            size_t filled = carry + got;
+            bool atEnd = (got == 0);
+            totalRead += got;
+
+            size_t lineStart = 0;
+            for (size_t i = carry; i < filled; i++) {
+                if (buffer[i] == '\n') {
+                    parseLine(string_view(buffer.data() + lineStart, i - lineStart), ++lineNumber, onRecord, report,
+                              journalLsn);
+                    lineStart = i + 1;
+                }
+            }
+
+            if (atEnd) {
+                if (lineStart < filled) {   // Last line without a newline
+                    parseLine(string_view(buffer.data() + lineStart, filled - lineStart), ++lineNumber, onRecord,
+                              report, journalLsn);
+                }
+                break;
+            }
+
+            carry = filled - lineStart;
+            if (carry > 0 && lineStart > 0) {
+                copy(buffer.begin() + lineStart, buffer.begin() + filled, buffer.begin());
+            }
+        }
+
+        fclose(file);
+        Stats::addBytesRead(totalRead);
+        return true;
+    }
+
+    bool write(const string& filename, const CompactPatientStore& store, uint64_t journalLsn) {
+        string text = lsnHeader(journalLsn);
+        text.reserve(store.size() * 64);
+        for (size_t i = 0; i < store.size(); i++) {
+            text += store.idAt(i);
+            text += ',';
+            text += store.nameAt(i);
+            text += ',';
+            text += to_string(store.ageAt(i));
+            text += ',';
+            text += store.conditionAt(i);
+            text += ',';
+            text += to_string(store.priorityAt(i));
+            text += ',';
+            text += store.admissionDateAt(i);
+            text += '\n';
+        }
+
+        string tempName = filename + ".tmp";
+        FILE* file = fopen(tempName.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        bool ok = (text.empty() || fwrite(text.data(), text.size(), 1, file) == 1) &&
+                  fflush(file) == 0;
+        if (ok) Stats::addBytesWritten(text.size());
+#ifndef _WIN32
+        ok = ok && fsync(fileno(file)) == 0;
+#endif
+        ok = (fclose(file) == 0) && ok;
+
+        if (ok) {
+#ifdef _WIN32
+            remove(filename.c_str());   // rename() does not replace on Windows
+#endif
+            ok = rename(tempName.c_str(), filename.c_str()) == 0;
+        }
+        if (!ok) {
+            remove(tempName.c_str());
+        }
+        return ok;
+    }
+
+    void printSummary(const LoadReport& report, const string& what, const string& filename) {
+        cout << "[INFO] Loaded " << report.loaded << " " << what << " from " << filename;
+        if (report.malformed > 0 || report.rejected > 0) {
+            cout << " (" << report.malformed << " malformed, " << report.rejected << " duplicates skipped)";
+        }
+        cout << "\n";
+
+        for (const string& problem : report.problems) {
+            cout << "[WARNING] " << filename << " " << problem << "\n";
+        }
+        long long total = report.malformed + report.rejected;
+        if (total > static_cast<long long>(report.problems.size())) {
+            cout << "[WARNING] ... " << (total - static_cast<long long>(report.problems.size()))
+                 << " more problem lines not shown\n";
+        }
+    }
+}
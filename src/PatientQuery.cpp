@@ -0,0 +1,136 @@
+#include "../include/PatientQuery.h"
+#include "../include/Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+
+using namespace std;
+
+PatientQuery::PatientQuery()
+    : minAge(INT_MIN), maxAge(INT_MAX), priorities(0), fromDay(INT_MIN), toDay(INT_MAX), limit(0) {}
+
+bool PatientQuery::hasAgeRange() const {
+    return minAge != INT_MIN || maxAge != INT_MAX;
+}
+
+bool PatientQuery::hasDateRange() const {
+    return fromDay != INT_MIN || toDay != INT_MAX;
+}
+
+static bool equalsIgnoreCase(char a, char b) {
+    return tolower(static_cast<unsigned char>(a)) == tolower(static_cast<unsigned char>(b));
+}
+
+bool PatientQuery::matches(const Patient& p, int day) const {
+    return matchesFields(p.age, p.priority, day) && matchesCondition(p.condition);
+}
+
+bool PatientQuery::matchesFields(int age, int priority, int day) const {
+    if (age < minAge || age > maxAge) return false;
+    if (priorities != 0 && (priority < 1 || priority > 3 || !(priorities & (1u << (priority - 1))))) {
+        return false;
+    }
+    return !hasDateRange() || (day != INT_MIN && day >= fromDay && day <= toDay);
+}
+
+bool PatientQuery::matchesCondition(const string& condition) const {
+    return conditionText.empty() ||
+           search(condition.begin(), condition.end(), conditionText.begin(), conditionText.end(),
+                  equalsIgnoreCase) != condition.end();
+}
+
+// Whole string is a non-negative integer
+static bool parseNumber(const string& text, int& value) {
+    if (text.empty() || text.size() > 9) return false;
+    for (char c : text) {
+        if (c < '0' || c > '9') return false;
+    }
+    value = atoi(text.c_str());
+    return true;
+}
+
+bool PatientQuery::parse(const string& spec, PatientQuery& query, string& problem) {
+    query = PatientQuery();
+    size_t start = 0;
+    while (start <= spec.size()) {
+        size_t comma = spec.find(',', start);
+        if (comma == string::npos) comma = spec.size();
+        string pair = spec.substr(start, comma - start);
+        start = comma + 1;
+        if (pair.empty()) continue;
+
+        size_t equals = pair.find('=');
+        if (equals == string::npos) {
+            problem = "expected key=value, got '" + pair + "'";
+            return false;
+        }
+        string key = pair.substr(0, equals);
+        string value = pair.substr(equals + 1);
+        transform(key.begin(), key.end(), key.begin(),
+                  [](unsigned char c) { return static_cast<char>(tolower(c)); });
+
+        if (key == "age") {
+            size_t dash = value.find('-');
+            string low = (dash == string::npos) ? value : value.substr(0, dash);
+            string high = (dash == string::npos) ? value : value.substr(dash + 1);
+            bool ok = !value.empty() && value != "-" &&
+                      (low.empty() || parseNumber(low, query.minAge)) &&
+                      (high.empty() || parseNumber(high, query.maxAge));
+            if (!ok || query.minAge > query.maxAge) {
+                problem = "invalid age range '" + value + "'";
+                return false;
+            }
+        } else if (key == "priority") {
+            for (char c : value) {
+                if (c < '1' || c > '3') {
+                    problem = "invalid priority list '" + value + "' (digits 1-3)";
+                    return false;
+                }
+                query.priorities |= 1u << (c - '1');
+            }
+        } else if (key == "from" || key == "to") {
+            int day;
+            if (!Utils::parseDate(value, day)) {
+                problem = "invalid date '" + value + "' (YYYY-MM-DD)";
+                return false;
+            }
+            (key == "from" ? query.fromDay : query.toDay) = day;
+        } else if (key == "condition") {
+            query.conditionText = value;
+        } else if (key == "limit") {
+            int limit;
+            if (!parseNumber(value, limit)) {
+                problem = "invalid limit '" + value + "'";
+                return false;
+            }
+            query.limit = static_cast<size_t>(limit);
+        } else {
+            problem = "unknown key '" + key + "' (age, priority, from, to, condition, limit)";
+            return false;
+        }
+    }
+    if (query.fromDay > query.toDay) {
+        problem = "'from' is after 'to'";
+        return false;
+    }
+    return true;
+}
+
+string PatientQuery::promptSpec() {
+    static const char* const PROMPTS[][2] = {
+        {"age", "Age range (e.g. 65-, 18-40, blank = any): "},
+        {"priority", "Priorities (e.g. 1 or 12, blank = any): "},
+        {"from", "Admitted on or after (YYYY-MM-DD, blank = any): "},
+        {"to", "Admitted on or before (YYYY-MM-DD, blank = any): "},
+        {"condition", "Condition contains (blank = any): "}
+    };
+    string spec;
+    for (const auto& prompt : PROMPTS) {
+        string value = Utils::getStringInput(prompt[1]);
+        if (value.empty()) continue;
+        if (!spec.empty()) spec += ',';
+        spec += string(prompt[0]) + "=" + value;
+    }
+    return spec;
+}
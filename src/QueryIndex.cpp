@@ -0,0 +1,246 @@
+#include "../include/QueryIndex.h"
+#include "../include/Utils.h"
+#include <climits>
+
+using namespace std;
+
+QueryIndex::QueryIndex() : priorityCounts{0, 0, 0}, datedCount(0) {}
+
+static bool validPriority(int priority) {
+    return priority >= 1 && priority <= 3;
+}
+
+// Appends slot to the key's bucket and returns its position there
+uint32_t QueryIndex::addToBucket(Buckets& buckets, int key, uint32_t slot) {
+    vector<uint32_t>& bucket = buckets[key];
+    bucket.push_back(slot);
+    return static_cast<uint32_t>(bucket.size() - 1);
+}
+
+// Swap-remove: the bucket's last slot takes the freed position
+void QueryIndex::removeFromBucket(Buckets& buckets, int key, uint32_t pos, bool byDay) {
+    auto it = buckets.find(key);
+    vector<uint32_t>& bucket = it->second;
+    uint32_t moved = bucket.back();
+    bucket[pos] = moved;
+    (byDay ? slots[moved].dayPos : slots[moved].agePos) = pos;
+    bucket.pop_back();
+    if (bucket.empty()) buckets.erase(it);
+}
+
+void QueryIndex::add(Node* node) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(slots.size());
+        slots.push_back(Slot());
+        for (vector<uint64_t>& bits : priorityBits) {
+            bits.resize(slots.size() / 64 + 1, 0);
+        }
+    }
+
+    const Patient& p = node->data;
+    Slot& entry = slots[slot];
+    entry.node = node;
+    entry.age = p.age;
+    entry.priority = p.priority;
+    if (!Utils::parseDate(p.admissionDate, entry.day)) {
+        entry.day = INT_MIN;
+    }
+    node->querySlot = static_cast<int>(slot);
+
+    if (validPriority(p.priority)) {
+        priorityBits[p.priority - 1][slot / 64] |= uint64_t(1) << (slot % 64);
+        priorityCounts[p.priority - 1]++;
+    }
+    entry.agePos = addToBucket(ageBuckets, entry.age, slot);
+    entry.dayPos = 0;
+    if (entry.day != INT_MIN) {
+        entry.dayPos = addToBucket(dayBuckets, entry.day, slot);
+        datedCount++;
+    }
+}
+
+void QueryIndex::remove(Node* node) {
+    if (node->querySlot < 0) return;
+    uint32_t slot = static_cast<uint32_t>(node->querySlot);
+    Slot& entry = slots[slot];
+
+    if (validPriority(entry.priority)) {
+        priorityBits[entry.priority - 1][slot / 64] &= ~(uint64_t(1) << (slot % 64));
+        priorityCounts[entry.priority - 1]--;
+    }
+    removeFromBucket(ageBuckets, entry.age, entry.agePos, false);
+    if (entry.day != INT_MIN) {
+        removeFromBucket(dayBuckets, entry.day, entry.dayPos, true);
+        datedCount--;
+    }
+
+    entry.node = nullptr;
+    freeSlots.push_back(slot);
+    node->querySlot = -1;
+}
+
+void QueryIndex::clear() {
+    for (const Slot& entry : slots) {
+        if (entry.node != nullptr) entry.node->querySlot = -1;
+    }
+    slots.clear();
+    freeSlots.clear();
+    for (int i = 0; i < 3; i++) {
+        priorityBits[i].clear();
+        priorityCounts[i] = 0;
+    }
+    ageBuckets.clear();
+    dayBuckets.clear();
+    datedCount = 0;
+}
+
+size_t QueryIndex::countRange(const Buckets& buckets, int low, int high) {
+    size_t total = 0;
+    for (auto it = buckets.lower_bound(low); it != buckets.end() && it->first <= high; ++it) {
+        total += it->second.size();
+    }
+    return total;
+}
+
+// Shared by the walks: checks the criteria (the node only for the condition),
+// then hands the match on. Returns false once the walk should stop.
+bool QueryIndex::offer(uint32_t slot, const PatientQuery& query, const Visitor& visit, size_t& visited) const {
+    const Slot& entry = slots[slot];
+    if (!query.matchesFields(entry.age, entry.priority, entry.day) ||
+        !query.matchesCondition(entry.node->data.condition)) {
+        return true;
+    }
+    visited++;
+    return visit(entry.node) && (query.limit == 0 || visited < query.limit);
+}
+
+size_t QueryIndex::walkRange(const Buckets& buckets, int low, int high,
+                             const PatientQuery& query, const Visitor& visit) const {
+    size_t visited = 0;
+    for (auto it = buckets.lower_bound(low); it != buckets.end() && it->first <= high; ++it) {
+        for (uint32_t slot : it->second) {
+            if (!offer(slot, query, visit, visited)) return visited;
+        }
+    }
+    return visited;
+}
+
+// Index of the lowest set bit (bits != 0)
+static int lowestBit(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#else
+    int bit = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+size_t QueryIndex::walkPriorities(const PatientQuery& query, const Visitor& visit) const {
+    size_t visited = 0;
+    size_t words = priorityBits[0].size();
+    for (size_t w = 0; w < words; w++) {
+        uint64_t bits = 0;
+        for (int p = 0; p < 3; p++) {
+            if (query.priorities & (1u << p)) bits |= priorityBits[p][w];
+        }
+        while (bits != 0) {
+            uint32_t slot = static_cast<uint32_t>(w * 64 + lowestBit(bits));
+            bits &= bits - 1;
+            if (!offer(slot, query, visit, visited)) return visited;
+        }
+    }
+    return visited;
+}
+
+size_t QueryIndex::walkAll(const PatientQuery& query, const Visitor& visit) const {
+    size_t visited = 0;
+    for (uint32_t slot = 0; slot < slots.size(); slot++) {
+        if (slots[slot].node != nullptr && !offer(slot, query, visit, visited)) break;
+    }
+    return visited;
+}
+
+size_t QueryIndex::walkDays(int fromDay, int toDay, bool newestFirst, size_t limit, const Visitor& visit) const {
+    size_t visited = 0;
+    auto first = dayBuckets.lower_bound(fromDay);
+    auto last = dayBuckets.upper_bound(toDay);
+    if (!newestFirst) {
+        for (auto it = first; it != last; ++it) {
+            for (uint32_t slot : it->second) {
+                visited++;
+                if (!visit(slots[slot].node) || visited == limit) return visited;
+            }
+        }
+        return visited;
+    }
+    // Days newest first; the day is the finest grain the records carry
+    for (auto it = last; it != first;) {
+        --it;
+        for (auto slot = it->second.rbegin(); slot != it->second.rend(); ++slot) {
+            visited++;
+            if (!visit(slots[*slot].node) || visited == limit) return visited;
+        }
+    }
+    return visited;
+}
+
+vector<pair<int, size_t>> QueryIndex::dailyCounts(int fromDay, int toDay) const {
+    vector<pair<int, size_t>> counts;
+    for (auto it = dayBuckets.lower_bound(fromDay); it != dayBuckets.end() && it->first <= toDay; ++it) {
+        counts.emplace_back(it->first, it->second.size());
+    }
+    return counts;
+}
+
+size_t QueryIndex::run(const PatientQuery& query, const Visitor& visit, string* plan) const {
+    enum Access { FULL_SCAN, BY_PRIORITY, BY_AGE, BY_DAY };
+    Access access = FULL_SCAN;
+    size_t candidates = size();
+
+    // Exact candidate counts, so the smallest set always wins
+    if (query.hasPriorities()) {
+        size_t estimate = 0;
+        for (int p = 0; p < 3; p++) {
+            if (query.priorities & (1u << p)) estimate += priorityCounts[p];
+        }
+        if (estimate < candidates) {
+            access = BY_PRIORITY;
+            candidates = estimate;
+        }
+    }
+    if (query.hasAgeRange()) {
+        size_t estimate = countRange(ageBuckets, query.minAge, query.maxAge);
+        if (estimate < candidates) {
+            access = BY_AGE;
+            candidates = estimate;
+        }
+    }
+    if (query.hasDateRange()) {
+        size_t estimate = countRange(dayBuckets, query.fromDay, query.toDay);
+        if (estimate < candidates) {
+            access = BY_DAY;
+            candidates = estimate;
+        }
+    }
+
+    if (plan != nullptr) {
+        static const char* const NAMES[] = {"full scan", "priority bitmap", "age index", "admission date index"};
+        *plan = string(NAMES[access]) + ", " + to_string(candidates) + " candidate(s) of " +
+                to_string(size()) + " records";
+    }
+
+    switch (access) {
+        case BY_PRIORITY: return walkPriorities(query, visit);
+        case BY_AGE:      return walkRange(ageBuckets, query.minAge, query.maxAge, query, visit);
+        case BY_DAY:      return walkRange(dayBuckets, query.fromDay, query.toDay, query, visit);
+        default:          return walkAll(query, visit);
+    }
+}
@@ -1,76 +1,225 @@
 #include "../include/QueueADT.h"
 #include "../include/Utils.h"
+#include "../include/PatientCsv.h"
+#include "../include/Snapshot.h"
+#include "../include/TableRenderer.h"
+#include "../include/Stats.h"
 #include <iostream>
-#include <fstream>
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
 using namespace std;
 
-QueueADT::QueueADT() : front(nullptr), rear(nullptr), size(0) {}
+QueueADT::QueueADT()
+    : nonEmptyMask(0), size(0), nextSeq(0), journal(nullptr), snapshotLsn(0), eventLog(nullptr) {
+    for (int i = 0; i < PRIORITY_LEVELS; i++) {
+        buckets[i].front = buckets[i].rear = nullptr;
+    }
+}
 
 QueueADT::~QueueADT() {
-    while (!isEmpty()) {
-        dequeue();
+    for (int i = 0; i < PRIORITY_LEVELS; i++) {
+        Node* current = buckets[i].front;
+        while (current != nullptr) {
+            Node* next = current->next;
+            pool.destroy(current);
+            current = next;
+        }
+        for (Node* node : buckets[i].retriaged) {
+            pool.destroy(node);
+        }
     }
 }
 
-void QueueADT::enqueue(Patient p) {
-    Node* newNode = new Node(p);
+int QueueADT::levelOf(int priority) {
+    // Only valid priorities get in (see admit and retriage)
+    return priority - 1;
+}
 
-    // Empty queue - insert directly
-    if (isEmpty()) {
-        front = rear = newNode;
-        size++;
-        cout << "Patient " << p.name << " added to queue (Priority: " << p.priority << ")\n";
-        return;
+int QueueADT::firstLevel() const {
+    // Lowest set bit of the 3-bit mask
+    static const int lowestBit[8] = {-1, 0, 1, 0, 2, 0, 1, 0};
+    return lowestBit[nonEmptyMask & 7u];
+}
+
+Node* QueueADT::bucketFront(int level) const {
+    const Bucket& bucket = buckets[level];
+    Node* fifo = bucket.front;
+    Node* heap = bucket.retriaged.empty() ? nullptr : bucket.retriaged.front();
+
+    if (fifo == nullptr) return heap;
+    if (heap == nullptr) return fifo;
+    return (heap->seq < fifo->seq) ? heap : fifo;
+}
+
+void QueueADT::updateMask(int level) {
+    const Bucket& bucket = buckets[level];
+    if (bucket.front != nullptr || !bucket.retriaged.empty()) {
+        nonEmptyMask |= (1u << level);
+    } else {
+        nonEmptyMask &= ~(1u << level);
     }
+}
 
-    // Priority-based insertion (1=Critical, 2=Urgent, 3=Normal)
-    // Lower number = higher priority (insert earlier in queue)
+void QueueADT::attach(Node* node, int level) {
+    Bucket& bucket = buckets[level];
+
+    // New arrivals always have the largest seq, so they append in O(1).
+    // A re-triaged patient who arrived earlier than the bucket's rear goes
+    // into the heap instead, which keeps their original place in line.
+    if (bucket.rear == nullptr || bucket.rear->seq < node->seq) {
+        node->next = nullptr;
+        node->prev = bucket.rear;
+        node->heapPos = -1;
+        if (bucket.rear == nullptr) {
+            bucket.front = node;
+        } else {
+            bucket.rear->next = node;
+        }
+        bucket.rear = node;
+    } else {
+        heapPush(level, node);
+    }
+    updateMask(level);
+}
 
-    // Case 1: New patient has highest priority (goes to front)
-    if (p.priority < front->data.priority) {
-        newNode->next = front;
-        front = newNode;
-        size++;
-        cout << "Patient " << p.name << " added to FRONT of queue (Priority: " << p.priority << ")\n";
-        return;
+void QueueADT::detach(Node* node, int level) {
+    Bucket& bucket = buckets[level];
+
+    if (node->heapPos >= 0) {
+        heapErase(level, node->heapPos);
+    } else {
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            bucket.front = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            bucket.rear = node->prev;
+        }
+        node->next = node->prev = nullptr;
+    }
+    updateMask(level);
+}
+
+void QueueADT::siftUp(vector<Node*>& heap, int pos) {
+    Node* node = heap[pos];
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (heap[parent]->seq <= node->seq) break;
+        heap[pos] = heap[parent];
+        heap[pos]->heapPos = pos;
+        pos = parent;
     }
+    heap[pos] = node;
+    node->heapPos = pos;
+}
 
-    // Case 2: Find correct position based on priority
-    Node* current = front;
-    while (current->next != nullptr && current->next->data.priority <= p.priority) {
-        current = current->next;
+void QueueADT::siftDown(vector<Node*>& heap, int pos) {
+    int n = static_cast<int>(heap.size());
+    Node* node = heap[pos];
+    while (true) {
+        int child = 2 * pos + 1;
+        if (child >= n) break;
+        if (child + 1 < n && heap[child + 1]->seq < heap[child]->seq) {
+            child++;
+        }
+        if (node->seq <= heap[child]->seq) break;
+        heap[pos] = heap[child];
+        heap[pos]->heapPos = pos;
+        pos = child;
     }
+    heap[pos] = node;
+    node->heapPos = pos;
+}
 
-    // Insert after current
-    newNode->next = current->next;
-    current->next = newNode;
+void QueueADT::heapPush(int level, Node* node) {
+    vector<Node*>& heap = buckets[level].retriaged;
+    node->next = node->prev = nullptr;
+    heap.push_back(node);
+    siftUp(heap, static_cast<int>(heap.size()) - 1);
+}
 
-    // Update rear if inserted at end
-    if (newNode->next == nullptr) {
-        rear = newNode;
+void QueueADT::heapErase(int level, int pos) {
+    vector<Node*>& heap = buckets[level].retriaged;
+    Node* removed = heap[pos];
+    Node* last = heap.back();
+    heap.pop_back();
+
+    if (removed != last) {
+        heap[pos] = last;
+        last->heapPos = pos;
+        siftUp(heap, pos);
+        siftDown(heap, last->heapPos);
+    }
+    removed->heapPos = -1;
+}
+
+bool QueueADT::enqueue(const Patient& p) {
+    Stats::Timer timer(Stats::QUEUE_ENQUEUE);
+    return admit(pool.create(p));
+}
+
+bool QueueADT::enqueue(Patient&& p) {
+    Stats::Timer timer(Stats::QUEUE_ENQUEUE);
+    return admit(pool.create(std::move(p)));
+}
+
+bool QueueADT::admit(Node* newNode, bool verbose) {
+    const Patient& p = newNode->data;
+    if (!isValidPriority(p.priority)) {
+        if (verbose) {
+            Utils::printError("Patient " + p.id + " has priority " + to_string(p.priority) +
+                              "; the queue only takes 1-3.");
+        }
+        pool.destroy(newNode);
+        return false;
+    }
+    if (!idIndex.insert(p.id, newNode)) {
+        if (verbose) {
+            Utils::printError("Patient " + p.id + " is already waiting in the queue.");
+        }
+        pool.destroy(newNode);
+        return false;
     }
 
+    newNode->seq = nextSeq++;
+    int level = levelOf(p.priority);
+
+    // Priority-based insertion (1=Critical, 2=Urgent, 3=Normal)
+    // Appending to the bucket's rear keeps FIFO order within a priority
+    int previousFirst = firstLevel();
+    attach(newNode, level);
     size++;
-    cout << "Patient " << p.name << " added to queue (Priority: " << p.priority << ")\n";
+    if (journal) journal->logEnqueue(p);
+    if (eventLog) eventLog->logEnqueue(p);
+
+    if (!verbose) {
+        return true;
+    }
+    if (previousFirst != -1 && level < previousFirst) {
+        cout << "Patient " << p.name << " added to FRONT of queue (Priority: " << p.priority << ")\n";
+    } else {
+        cout << "Patient " << p.name << " added to queue (Priority: " << p.priority << ")\n";
+    }
+    return true;
 }
 
 Patient QueueADT::dequeue() {
+    Stats::Timer timer(Stats::QUEUE_DEQUEUE);
     if (isEmpty()) {
         Utils::printError("Queue is empty!");
         return Patient(); // Return empty patient
     }
 
-    Node* temp = front;
-    Patient data = temp->data;
-    front = front->next;
-
-    if (front == nullptr) {
-        rear = nullptr;
-    }
-
-    delete temp;
+    int level = firstLevel();
+    Node* temp = bucketFront(level);
+    detach(temp, level);
+    idIndex.erase(temp->data.id);
+    if (journal) journal->logDequeue(temp->data.id);
+    if (eventLog) eventLog->logDequeue(temp->data.id);
+    Patient data = std::move(temp->data);
+    pool.destroy(temp);
     size--;
     return data;
 }
@@ -80,11 +229,318 @@ Patient QueueADT::peek() const {
         Utils::printError("Queue is empty!");
         return Patient();
     }
-    return front->data;
+    return bucketFront(firstLevel())->data;
+}
+
+bool QueueADT::retriage(const string& id, int newPriority) {
+    Stats::Timer timer(Stats::QUEUE_RETRIAGE);
+    Node* const* found = idIndex.find(id);
+    if (found == nullptr || !isValidPriority(newPriority)) {
+        return false;
+    }
+
+    Node* node = *found;
+    int oldLevel = levelOf(node->data.priority);
+    int newLevel = levelOf(newPriority);
+
+    if (oldLevel != newLevel) {
+        detach(node, oldLevel);
+        node->data.priority = newPriority;
+        attach(node, newLevel);   // Keeps the original seq
+    } else {
+        node->data.priority = newPriority;
+    }
+    if (journal) journal->logRetriage(id, newPriority);
+    if (eventLog) eventLog->logRetriage(id, newPriority);
+    return true;
+}
+
+bool QueueADT::remove(const string& id) {
+    Stats::Timer timer(Stats::QUEUE_REMOVE);
+    Node* const* found = idIndex.find(id);
+    if (found == nullptr) {
+        return false;
+    }
+
+    Node* node = *found;
+    detach(node, levelOf(node->data.priority));
+    if (journal) journal->logRemove(id);
+    if (eventLog) eventLog->logRemove(id);
+    idIndex.erase(id);
+    pool.destroy(node);
+    size--;
+    return true;
+}
+
+const Patient* QueueADT::find(const string& id) const {
+    Node* const* found = idIndex.find(id);
+    return found != nullptr ? &(*found)->data : nullptr;
+}
+
+vector<const Node*> QueueADT::orderedNodes() const {
+    vector<const Node*> ordered;
+    ordered.reserve(size);
+
+    for (int level = 0; level < PRIORITY_LEVELS; level++) {
+        // Merge the FIFO with the (usually tiny) re-triage heap by seq
+        vector<const Node*> heap(buckets[level].retriaged.begin(), buckets[level].retriaged.end());
+        sort(heap.begin(), heap.end(), [](const Node* a, const Node* b) {
+            return a->seq < b->seq;
+        });
+
+        const Node* fifo = buckets[level].front;
+        size_t h = 0;
+        while (fifo != nullptr || h < heap.size()) {
+            if (fifo == nullptr || (h < heap.size() && heap[h]->seq < fifo->seq)) {
+                ordered.push_back(heap[h++]);
+            } else {
+                ordered.push_back(fifo);
+                fifo = fifo->next;
+            }
+        }
+    }
+    return ordered;
+}
+
+void QueueADT::sortRetriaged(SortedRetriaged& sorted) const {
+    // Re-triaged patients are few, so a sorted copy per page is cheap
+    for (int level = 0; level < PRIORITY_LEVELS; level++) {
+        sorted[level].assign(buckets[level].retriaged.begin(), buckets[level].retriaged.end());
+        sort(sorted[level].begin(), sorted[level].end(), [](const Node* a, const Node* b) {
+            return a->seq < b->seq;
+        });
+    }
+}
+
+void QueueADT::settle(PageCursor& cursor, const SortedRetriaged& sorted) const {
+    while (cursor.level < PRIORITY_LEVELS &&
+           cursor.fifo == nullptr && cursor.heapIndex >= sorted[cursor.level].size()) {
+        cursor.level++;
+        cursor.fifo = (cursor.level < PRIORITY_LEVELS) ? buckets[cursor.level].front : nullptr;
+        cursor.heapIndex = 0;
+    }
+}
+
+// Returns the patient at the cursor and moves past it (nullptr at the end)
+const Node* QueueADT::stepForward(PageCursor& cursor, const SortedRetriaged& sorted) const {
+    settle(cursor, sorted);
+    if (cursor.level >= PRIORITY_LEVELS) {
+        return nullptr;
+    }
+
+    const vector<const Node*>& heap = sorted[cursor.level];
+    const Node* fromHeap = cursor.heapIndex < heap.size() ? heap[cursor.heapIndex] : nullptr;
+    const Node* taken;
+    if (cursor.fifo != nullptr && (fromHeap == nullptr || cursor.fifo->seq < fromHeap->seq)) {
+        taken = cursor.fifo;
+        cursor.fifo = cursor.fifo->next;
+    } else {
+        taken = fromHeap;
+        cursor.heapIndex++;
+    }
+    if (cursor.index >= 0) cursor.index++;
+    settle(cursor, sorted);
+    return taken;
+}
+
+// Moves the cursor back by one patient; false if already at the front
+bool QueueADT::stepBackward(PageCursor& cursor, const SortedRetriaged& sorted) const {
+    int level = cursor.level;
+    const Node* fifo = cursor.fifo;
+    size_t heapIndex = cursor.heapIndex;
+
+    while (level >= 0) {
+        if (level < PRIORITY_LEVELS) {
+            // Previous FIFO node is fifo->prev, or the rear once the FIFO was done
+            const Node* fromFifo = (fifo != nullptr) ? fifo->prev : buckets[level].rear;
+            const Node* fromHeap = heapIndex > 0 ? sorted[level][heapIndex - 1] : nullptr;
+            if (fromFifo != nullptr || fromHeap != nullptr) {
+                if (fromFifo != nullptr && (fromHeap == nullptr || fromFifo->seq > fromHeap->seq)) {
+                    fifo = fromFifo;
+                } else {
+                    heapIndex--;
+                }
+                cursor.level = level;
+                cursor.fifo = fifo;
+                cursor.heapIndex = heapIndex;
+                if (cursor.index > 0) cursor.index--;
+                return true;
+            }
+        }
+        // Nothing earlier in this bucket: continue from the end of the previous one
+        level--;
+        fifo = nullptr;
+        heapIndex = (level >= 0) ? sorted[level].size() : 0;
+    }
+    return false;
+}
+
+QueueADT::PageCursor QueueADT::firstPage() const {
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+    PageCursor cursor{0, buckets[0].front, 0, 0};
+    settle(cursor, sorted);
+    return cursor;
+}
+
+QueueADT::PageCursor QueueADT::lastPage(int pageSize) const {
+    if (size == 0 || pageSize <= 0) {
+        return firstPage();
+    }
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+
+    // Step back from the end to the start of the last page
+    PageCursor cursor{PRIORITY_LEVELS, nullptr, 0, size};
+    long long start = ((size - 1) / pageSize) * static_cast<long long>(pageSize);
+    for (long long i = size; i > start; i--) {
+        stepBackward(cursor, sorted);
+    }
+    cursor.index = start;
+    return cursor;
+}
+
+QueueADT::PageCursor QueueADT::nextPage(const PageCursor& page, int pageSize) const {
+    if (pageSize <= 0) return page;
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+
+    PageCursor cursor = page;
+    for (int i = 0; i < pageSize && stepForward(cursor, sorted) != nullptr; i++) {}
+    if (cursor.level >= PRIORITY_LEVELS) {
+        return page;   // Already on the last page
+    }
+    return cursor;
+}
+
+QueueADT::PageCursor QueueADT::prevPage(const PageCursor& page, int pageSize) const {
+    if (pageSize <= 0) return page;
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+
+    PageCursor cursor = page;
+    int moved = 0;
+    while (moved < pageSize && stepBackward(cursor, sorted)) {
+        moved++;
+    }
+    if (moved < pageSize) {
+        return firstPage();   // Reached the front, so the position is known again
+    }
+    return cursor;
+}
+
+QueueADT::PageCursor QueueADT::jumpToPage(long long pageNumber, int pageSize) const {
+    if (pageSize <= 0) return firstPage();
+    long long lastNumber = (size == 0) ? 1 : (size - 1) / pageSize + 1;
+    if (pageNumber <= 1) return firstPage();
+    if (pageNumber >= lastNumber) return lastPage(pageSize);
+
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+    PageCursor cursor = firstPage();
+    for (long long i = (pageNumber - 1) * pageSize; i > 0; i--) {
+        stepForward(cursor, sorted);
+    }
+    return cursor;
+}
+
+bool QueueADT::pageFromID(const string& id, PageCursor& page) const {
+    Node* const* found = idIndex.find(id);
+    if (found == nullptr) {
+        return false;
+    }
+    const Node* node = *found;
+    int level = levelOf(node->data.priority);
+
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+    const vector<const Node*>& heap = sorted[level];
+
+    // Re-triaged patients earlier in line than this one come first
+    size_t heapIndex = lower_bound(heap.begin(), heap.end(), node, [](const Node* a, const Node* b) {
+        return a->seq < b->seq;
+    }) - heap.begin();
+
+    const Node* fifo;
+    if (node->heapPos < 0) {
+        fifo = node;
+    } else {
+        // The patient is in the heap: find the first FIFO arrival after them
+        fifo = buckets[level].front;
+        while (fifo != nullptr && fifo->seq < node->seq) fifo = fifo->next;
+    }
+
+    page = PageCursor{level, fifo, heapIndex, -1};
+    return true;
+}
+
+vector<const Patient*> QueueADT::pageRecords(const PageCursor& page, int pageSize) const {
+    vector<const Patient*> records;
+    if (pageSize <= 0) return records;
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+
+    records.reserve(pageSize);
+    PageCursor cursor = page;
+    const Node* current;
+    while (static_cast<int>(records.size()) < pageSize && (current = stepForward(cursor, sorted)) != nullptr) {
+        records.push_back(&current->data);
+    }
+    return records;
+}
+
+void QueueADT::displayPage(const PageCursor& page, int pageSize) const {
+    if (pageSize <= 0) {
+        Utils::printError("Page size must be at least 1.");
+        return;
+    }
+    if (isEmpty()) {
+        cout << "Queue is empty.\n";
+        return;
+    }
+
+    SortedRetriaged sorted;
+    sortRetriaged(sorted);
+
+    TableRenderer table;
+    table.setColumns({{"Pos", 5}, {"ID", 8}, {"Name", 25}, {"Priority", 10}, {"Condition", 0}});
+    table.reserveRows(pageSize);
+
+    table.text("\n");
+    table.rule('=', 95);
+    table.text("  INTELLIGENT CLINIC QUEUE MANAGEMENT SYSTEM - PATIENT WAITING QUEUE\n");
+    table.rule('=', 95);
+    table.header();
+    table.rule('-', 95);
+
+    PageCursor cursor = page;
+    int shown = 0;
+    const Node* current;
+    while (shown < pageSize && (current = stepForward(cursor, sorted)) != nullptr) {
+        if (page.index >= 0) {
+            table.cell(page.index + shown + 1);
+        } else {
+            table.cell("-");
+        }
+        table.cell(current->data.id).cell(current->data.name)
+             .cell(current->data.priority).cell(current->data.condition);
+        table.endRow();
+        shown++;
+    }
+
+    table.rule('-', 95);
+    if (page.index >= 0) {
+        long long pages = (size - 1) / pageSize + 1;
+        table.text("Page " + to_string(page.index / pageSize + 1) + " of " + to_string(pages) +
+                   "  (total in queue: " + to_string(size) + ")\n\n");
+    } else {
+        table.text("Total in queue: " + to_string(size) + "\n\n");
+    }
+    table.flush();
 }
 
 bool QueueADT::isEmpty() const {
-    return front == nullptr;
+    return nonEmptyMask == 0;
 }
 
 int QueueADT::getSize() const {
@@ -97,96 +553,107 @@ void QueueADT::display() const {
         return;
     }
 
-    Node* current = front;
     int position = 1;
 
+    // Whole table is built in one buffer and written at once
+    TableRenderer table;
+    table.setColumns({{"Pos", 5}, {"ID", 8}, {"Name", 25}, {"Priority", 10}, {"Condition", 0}});
+    table.reserveRows(size);
+
     // Top border
-    cout << "\n" << string(95, '=') << "\n";
-    cout << "  INTELLIGENT CLINIC QUEUE MANAGEMENT SYSTEM - PATIENT WAITING QUEUE\n";
-    cout << string(95, '=') << "\n";
-
-    // Header row
-    cout << left
-         << setw(5) << "Pos" << " | "
-         << setw(8) << "ID" << " | "
-         << setw(25) << "Name" << " | "
-         << setw(10) << "Priority" << " | "
-         << "Condition\n";
-
-    // Separator line
-    cout << string(95, '-') << "\n";
-
-    // Data rows
-    while (current != nullptr) {
-        cout << left
-             << setw(5) << position << " | "
-             << setw(8) << current->data.id << " | "
-             << setw(25) << current->data.name << " | "
-             << setw(10) << current->data.priority << " | "
-             << current->data.condition << "\n";
-
-        current = current->next;
+    table.text("\n");
+    table.rule('=', 95);
+    table.text("  INTELLIGENT CLINIC QUEUE MANAGEMENT SYSTEM - PATIENT WAITING QUEUE\n");
+    table.rule('=', 95);
+
+    // Header row and separator line
+    table.header();
+    table.rule('-', 95);
+
+    // Data rows (most urgent bucket first, arrival order within each bucket)
+    for (const Node* current : orderedNodes()) {
+        table.cell(position).cell(current->data.id).cell(current->data.name)
+             .cell(current->data.priority).cell(current->data.condition);
+        table.endRow();
         position++;
     }
 
     // Bottom border
-    cout << string(95, '-') << "\n";
-    cout << "Total in queue: " << size << "\n\n";
+    table.rule('-', 95);
+    table.text("Total in queue: " + to_string(size) + "\n\n");
+    table.flush();
 }
 
-void QueueADT::saveToFile(const string& filename) const {
-    ofstream file(filename);
-    if (!file.is_open()) {
-        Utils::printError("Cannot open file for writing: " + filename);
-        return;
-    }
-
-    Node* current = front;
-    while (current != nullptr) {
-        file << current->data.id << ","
-             << current->data.name << ","
-             << current->data.age << ","
-             << current->data.condition << ","
-             << current->data.priority << ","
-             << current->data.admissionDate << "\n";
-        current = current->next;
+bool QueueADT::saveToFile(const string& filename) const {
+    Stats::Timer timer(Stats::QUEUE_SAVE);
+    // Both formats go through a temp file + fsync + rename, so a failed
+    // save leaves the previous file intact
+    CompactPatientStore store;
+    archiveTo(store);
+    uint64_t lsn = journal ? journal->getLastLsn() : 0;
+    bool saved = Snapshot::isSnapshotFile(filename)
+                 ? Snapshot::write(filename, Snapshot::QUEUE, store, lsn)
+                 : PatientCsv::write(filename, store, lsn);
+    if (!saved) {
+        Utils::printError("Cannot write " + filename);
+        return false;
     }
-
-    file.close();
     cout << "[INFO] Queue saved to " << filename << "\n";
+    return true;
 }
 
 void QueueADT::loadFromFile(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+    Stats::Timer timer(Stats::QUEUE_LOAD);
+    // Bulk path: block reads, in-place field splitting, no per-record output
+    // (binary snapshots stream through the same callback). Files are saved in
+    // service order and each record gets the next seq, so every one appends
+    // to its bucket's FIFO in O(1) and the whole rebuild is linear.
+    // Loaded patients are already durable and already in the event history.
+    Journal* attached = journal;
+    QueueEventLog* attachedLog = eventLog;
+    journal = nullptr;
+    eventLog = nullptr;
+    snapshotLsn = 0;
+
+    PatientCsv::LoadReport report;
+    auto onRecord = [this](const PatientCsv::Record& rec) {
+        Node* node = pool.create(std::in_place, string(rec.id), string(rec.name), rec.age,
+                                 string(rec.condition), rec.priority, string(rec.admissionDate));
+        return admit(node, false);
+    };
+    bool opened = Snapshot::isSnapshotFile(filename)
+                  ? Snapshot::load(filename, Snapshot::QUEUE, onRecord, report, &snapshotLsn)
+                  : PatientCsv::load(filename, onRecord, report, &snapshotLsn);
+    journal = attached;
+    eventLog = attachedLog;
+
+    if (!opened) {
         cout << "[INFO] No existing queue data found. Starting fresh.\n";
         return;
     }
+    PatientCsv::printSummary(report, "patients into queue", filename);
+}
 
-    string line;
-    int loaded = 0;
-
-    while (getline(file, line)) {
-        if (line.empty()) continue;
-
-        stringstream ss(line);
-        string id, name, condition, date;
-        int age, priority;
-
-        getline(ss, id, ',');
-        getline(ss, name, ',');
-        ss >> age;
-        ss.ignore();
-        getline(ss, condition, ',');
-        ss >> priority;
-        ss.ignore();
-        getline(ss, date);
-
-        Patient p(id, name, age, condition, priority, date);
-        enqueue(p);
-        loaded++;
+void QueueADT::archiveTo(CompactPatientStore& store) const {
+    store.reserve(store.size() + size);
+    for (const Node* current : orderedNodes()) {
+        store.append(current->data);
     }
+}
 
-    file.close();
-    cout << "[INFO] Loaded " << loaded << " patients into queue from " << filename << "\n";
-}
\ No newline at end of file
+void QueueADT::applyJournalEntry(const Journal::Entry& entry) {
+    switch (entry.op) {
+        case Journal::QUEUE_ENQUEUE:
+            admit(pool.create(entry.patient), false);
+            break;
+        case Journal::QUEUE_DEQUEUE:
+        case Journal::QUEUE_REMOVE:
+            remove(entry.id);   // By ID, so replay does not depend on queue order
+            break;
+        case Journal::QUEUE_RETRIAGE:
+            retriage(entry.id, entry.value);
+            break;
+        default:
+            break;   // Patient record operations are not ours
+    }
+}
@@ -0,0 +1,165 @@
+#include "../include/QueueEventLog.h"
+#include "../include/QueueADT.h"
+#include "../include/Journal.h"
+#include "../include/PatientCsv.h"
+#include "../include/Utils.h"
+#include "../include/Stats.h"
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+static const size_t TIMESTAMP_LENGTH = 19;   // "YYYY-MM-DD HH:MM:SS"
+
+QueueEventLog::QueueEventLog() : file(nullptr), operatorName("system") {}
+
+QueueEventLog::~QueueEventLog() {
+    close();
+}
+
+bool QueueEventLog::open(const string& filename) {
+    close();
+    file = fopen(filename.c_str(), "ab");
+    return file != nullptr;
+}
+
+void QueueEventLog::close() {
+    if (file != nullptr) {
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+void QueueEventLog::setOperator(const string& username) {
+    operatorName = username.empty() ? "system" : username;
+}
+
+void QueueEventLog::write(const string& event, const string& fields) {
+    if (file == nullptr) return;
+
+    // One line per event; durability comes from the journal, so no fsync here
+    string line = Utils::currentTimestamp() + "," + event + "," + operatorName + "," + fields + "\n";
+    fwrite(line.data(), 1, line.size(), file);
+    fflush(file);
+    Stats::addBytesWritten(line.size());
+}
+
+void QueueEventLog::logEnqueue(const Patient& p) {
+    write("ENQUEUE", p.id + "," + p.name + "," + to_string(p.age) + "," + p.condition + "," +
+                     to_string(p.priority) + "," + p.admissionDate);
+}
+
+void QueueEventLog::logDequeue(const string& id) {
+    write("DEQUEUE", id);
+}
+
+void QueueEventLog::logRemove(const string& id) {
+    write("REMOVE", id);
+}
+
+void QueueEventLog::logRetriage(const string& id, int newPriority) {
+    write("RETRIAGE", id + "," + to_string(newPriority));
+}
+
+// Splits into at most maxFields fields; the last one keeps any extra commas
+static vector<string> splitFields(const string& line, size_t maxFields) {
+    vector<string> fields;
+    size_t start = 0;
+    while (fields.size() + 1 < maxFields) {
+        size_t comma = line.find(',', start);
+        if (comma == string::npos) break;
+        fields.push_back(line.substr(start, comma - start));
+        start = comma + 1;
+    }
+    fields.push_back(line.substr(start));
+    return fields;
+}
+
+// "YYYY-MM-DD HH:MM:SS" with a real date and time
+static bool isTimestamp(const string& text) {
+    int day, seconds;
+    return text.size() == TIMESTAMP_LENGTH && text[10] == ' ' &&
+           Utils::parseDate(text.substr(0, 10), day) && Utils::parseTimeOfDay(text.substr(11), seconds);
+}
+
+bool QueueEventLog::isValidCutoff(const string& until) {
+    int day, seconds;
+    if (until.size() == 10) return Utils::parseDate(until, day);
+    return until.size() > 11 && until[10] == ' ' &&
+           Utils::parseDate(until.substr(0, 10), day) && Utils::parseTimeOfDay(until.substr(11), seconds);
+}
+
+// Turns the fields after the operator into a queue mutation
+static bool parseEvent(const string& event, const string& fields, Journal::Entry& entry) {
+    if (event == "ENQUEUE") {
+        // Same layout and limits as a queue.txt line
+        PatientCsv::Record rec;
+        string problem;
+        if (!PatientCsv::parseRecord(fields, rec, problem)) return false;
+        entry.op = Journal::QUEUE_ENQUEUE;
+        entry.patient = Patient(string(rec.id), string(rec.name), rec.age, string(rec.condition),
+                                rec.priority, string(rec.admissionDate));
+        return true;
+    }
+    if (event == "DEQUEUE" || event == "REMOVE") {
+        entry.op = (event == "DEQUEUE") ? Journal::QUEUE_DEQUEUE : Journal::QUEUE_REMOVE;
+        entry.id = fields;
+        return !entry.id.empty() && entry.id.find(',') == string::npos;
+    }
+    if (event == "RETRIAGE") {
+        vector<string> f = splitFields(fields, 2);
+        if (f.size() < 2 || f[0].empty() || f[1].size() != 1 || f[1][0] < '1' || f[1][0] > '3') return false;
+        entry.op = Journal::QUEUE_RETRIAGE;
+        entry.id = f[0];
+        entry.value = f[1][0] - '0';
+        return true;
+    }
+    return false;
+}
+
+long long QueueEventLog::replay(const string& filename, const string& until, QueueADT& queue,
+                                long long* skipped) {
+    if (skipped != nullptr) *skipped = 0;
+    if (!isValidCutoff(until)) {
+        return -1;
+    }
+    ifstream in(filename);
+    if (!in.is_open()) {
+        return -1;
+    }
+
+    long long applied = 0;
+    string line;
+    while (getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        // timestamp, event, operator, then the event's own fields
+        vector<string> head = splitFields(line, 4);
+        if (head.size() < 4 || !isTimestamp(head[0])) {
+            if (skipped != nullptr) (*skipped)++;
+            continue;
+        }
+
+        // Events are appended in time order, so stop at the first one past the cutoff
+        if (head[0].compare(0, until.size(), until) > 0) break;
+
+        Journal::Entry entry;
+        if (!parseEvent(head[1], head[3], entry)) {
+            if (skipped != nullptr) (*skipped)++;
+            continue;
+        }
+        queue.applyJournalEntry(entry);
+        applied++;
+    }
+    return applied;
+}
+
+bool QueueEventLog::isEventLog(const string& filename) {
+    ifstream in(filename);
+    string line;
+    if (!getline(in, line)) {
+        return true;   // Empty or unreadable: nothing to migrate
+    }
+    return line.size() > TIMESTAMP_LENGTH && isTimestamp(line.substr(0, TIMESTAMP_LENGTH));
+}
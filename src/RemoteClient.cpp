@@ -0,0 +1,660 @@
+#include "../include/RemoteClient.h"
+#include "../include/PatientCsv.h"
+#include "../include/PatientQuery.h"
+#include "../include/TableRenderer.h"
+#include "../include/Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#ifndef _WIN32
+    #include <cerrno>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+
+static const int PAGE_SIZE = 20;
+static const size_t MAX_RESULT_ROWS = 100;     // Longer query results are cut short
+
+// DAILY response: OK, DAILY, total, then "YYYY-MM-DD,count" per day
+static void printDailyCounts(const vector<string>& fields) {
+    cout << "\n" << left << setw(12) << "Date" << " | Admissions\n" << string(26, '-') << "\n";
+    for (size_t i = 3; i < fields.size() && i < 3 + MAX_RESULT_ROWS; i++) {
+        size_t comma = fields[i].find(',');
+        cout << left << setw(12) << fields[i].substr(0, comma) << " | " << fields[i].substr(comma + 1) << "\n";
+    }
+    if (fields.size() > 3 + MAX_RESULT_ROWS) {
+        cout << "... " << (fields.size() - 3 - MAX_RESULT_ROWS) << " more day(s)\n";
+    }
+    cout << string(26, '-') << "\n" << left << setw(12) << "Total" << " | " << fields[2] << "\n";
+}
+
+static vector<string> splitFields(const string& line) {
+    vector<string> fields;
+    size_t start = 0;
+    while (true) {
+        size_t tab = line.find('\t', start);
+        fields.push_back(line.substr(start, tab - start));
+        if (tab == string::npos) return fields;
+        start = tab + 1;
+    }
+}
+
+// ERR<TAB>COMMAND<TAB>message -> message
+static string errorOf(const vector<string>& fields) {
+    return fields.size() >= 3 ? fields[2] : "Connection to server lost.";
+}
+
+static bool parsePatient(const string& field, Patient& p) {
+    PatientCsv::Record rec;
+    string problem;
+    if (!PatientCsv::parseRecord(field, rec, problem)) {
+        return false;
+    }
+    p = Patient(string(rec.id), string(rec.name), rec.age, string(rec.condition),
+                rec.priority, string(rec.admissionDate));
+    return true;
+}
+
+static string formatRecord(const Patient& p) {
+    return p.id + "," + p.name + "," + to_string(p.age) + "," + p.condition + "," +
+           to_string(p.priority) + "," + p.admissionDate;
+}
+
+RemoteClient::RemoteClient() : fd(-1), admin(false), connected(false), done(false) {}
+
+#ifndef _WIN32
+
+RemoteClient::~RemoteClient() {
+    if (fd >= 0) close(fd);
+}
+
+bool RemoteClient::connect(const string& path) {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        Utils::printError("Socket path is empty or too long: " + path);
+        return false;
+    }
+    memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        Utils::printError("Cannot connect to " + path + ": " + strerror(errno));
+        if (fd >= 0) close(fd);
+        fd = -1;
+        return false;
+    }
+    connected = true;
+    return true;
+}
+
+bool RemoteClient::readLine(string& line) {
+    while (true) {
+        size_t newline = pending.find('\n');
+        if (newline != string::npos) {
+            line = pending.substr(0, newline);
+            pending.erase(0, newline + 1);
+            return true;
+        }
+        char buffer[1 << 16];
+        ssize_t got = recv(fd, buffer, sizeof(buffer), 0);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return false;
+        pending.append(buffer, static_cast<size_t>(got));
+    }
+}
+
+bool RemoteClient::request(const string& line, vector<string>& fields) {
+    fields.clear();
+    if (!connected) return false;
+
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    string out = line + "\n";
+    size_t sent = 0;
+    string response;
+    while (sent < out.size()) {
+        ssize_t n = send(fd, out.data() + sent, out.size() - sent, flags);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        sent += static_cast<size_t>(n);
+    }
+    if (sent < out.size() || !readLine(response)) {
+        connected = false;
+        Utils::printError("Connection to server lost.");
+        return false;
+    }
+    fields = splitFields(response);
+    return fields[0] == "OK";
+}
+
+#else   // Unix domain sockets are not available in this build
+
+RemoteClient::~RemoteClient() {}
+
+bool RemoteClient::connect(const string&) {
+    Utils::printError("Client mode needs Unix domain sockets (not supported on this platform).");
+    return false;
+}
+
+bool RemoteClient::readLine(string&) { return false; }
+
+bool RemoteClient::request(const string&, vector<string>& fields) {
+    fields.clear();
+    return false;
+}
+
+#endif
+
+int RemoteClient::run() {
+    Utils::printHeader("INTELLIGENT CLINIC QUEUE MANAGEMENT SYSTEM");
+    cout << "Welcome to the Intelligent Clinic Queue Management System\n";
+
+    while (connected && !done) {
+        if (username.empty()) {
+            showLoginMenu();
+        } else if (admin) {
+            showAdminMenu();
+        } else {
+            showDoctorMenu();
+        }
+    }
+    return done ? 0 : 1;
+}
+
+// ============= MENUS =============
+
+void RemoteClient::showLoginMenu() {
+    Utils::clearScreen();
+    Utils::printHeader("LOGIN");
+
+    cout << "1. Login\n";
+    cout << "2. Exit System\n";
+
+    int choice = Utils::getIntInput("Enter choice: ", 1, 2);
+
+    if (choice == 1) {
+        string name = Utils::getStringInput("Username: ");
+        string password = Utils::getStringInput("Password: ");
+
+        vector<string> fields;
+        if (request("LOGIN " + name + "," + password, fields)) {
+            username = name;
+            admin = fields.size() >= 3 && fields[2] == "ADMIN";
+            Utils::printSuccess("Login successful! Welcome, " + username);
+            Utils::sleep(3);
+        } else if (connected) {
+            Utils::printError("Invalid username or password.");
+            Utils::pauseScreen();
+        }
+    } else {
+        vector<string> fields;
+        request("QUIT", fields);
+        done = true;
+        cout << "Exiting Intelligent Clinic Queue Management System. Goodbye!\n";
+    }
+}
+
+void RemoteClient::showAdminMenu() {
+    Utils::clearScreen();
+    Utils::printHeader("ADMIN MENU - " + username);
+
+    cout << "=== Patient Records Management ===\n";
+    cout << "1.  Add Patient Record\n";
+    cout << "2.  Search Patient\n";
+    cout << "3.  Delete Patient Record\n";
+    cout << "4.  Display All Patients\n";
+    cout << "5.  Sort Patient Records\n";
+    cout << "6.  Edit Patient Record\n";
+
+    cout << "\n=== Queue Management ===\n";
+    cout << "7.  Add Patient to Queue\n";
+    cout << "8.  Process Next Patient\n";
+    cout << "9.  View Current Queue\n";
+    cout << "10. Re-triage Patient in Queue\n";
+    cout << "11. Remove Patient from Queue\n";
+    cout << "\n12. Logout\n";
+
+    int choice = Utils::getIntInput("\nEnter choice: ", 1, 12);
+    vector<string> fields;
+
+    switch (choice) {
+        case 1: addPatientRecord(); break;
+        case 2: searchPatient(); break;
+        case 3: deletePatientRecord(); break;
+        case 4: browsePages("LIST", "ALL PATIENT RECORDS"); break;
+        case 5: sortPatients(); break;
+        case 6: editPatientRecord(); break;
+        case 7: addPatientToQueue(); break;
+        case 8: processNextPatient(); break;
+        case 9: browsePages("QUEUE", "CURRENT QUEUE"); break;
+        case 10: retriagePatient(); break;
+        case 11: removeFromQueue(); break;
+        case 12:
+            request("LOGOUT", fields);
+            cout << "Goodbye, " << username << "!\n";
+            username.clear();
+            break;
+    }
+}
+
+void RemoteClient::showDoctorMenu() {
+    Utils::clearScreen();
+    Utils::printHeader("DOCTOR MENU - " + username);
+
+    cout << "1. View Patient Records\n";
+    cout << "2. Search Patient\n";
+    cout << "3. View Current Queue\n";
+    cout << "4. Process Next Patient\n";
+    cout << "5. Re-triage Patient in Queue\n";
+    cout << "6. Remove Patient from Queue\n";
+    cout << "7. Logout\n";
+
+    int choice = Utils::getIntInput("\nEnter choice: ", 1, 7);
+    vector<string> fields;
+
+    switch (choice) {
+        case 1: browsePages("LIST", "ALL PATIENT RECORDS"); break;
+        case 2: searchPatient(); break;
+        case 3: browsePages("QUEUE", "CURRENT QUEUE"); break;
+        case 4: processNextPatient(); break;
+        case 5: retriagePatient(); break;
+        case 6: removeFromQueue(); break;
+        case 7:
+            request("LOGOUT", fields);
+            cout << "Goodbye, " << username << "!\n";
+            username.clear();
+            break;
+    }
+}
+
+// ============= PATIENT RECORDS =============
+
+void RemoteClient::addPatientRecord() {
+    Utils::printHeader("ADD NEW PATIENT");
+
+    Patient p;
+    p.id = Utils::getStringInput("Patient ID (e.g., P001): ");
+    p.name = Utils::getStringInput("Patient Name: ");
+    p.age = Utils::getIntInput("Age: ", 0, 150);
+    p.condition = Utils::getStringInput("Condition: ");
+    p.priority = Utils::getIntInput("Priority (1=Critical, 2=Urgent, 3=Normal): ", 1, 3);
+    p.admissionDate = Utils::getDateInput("Admission Date (YYYY-MM-DD): ");
+
+    vector<string> fields;
+    if (request("ADD " + formatRecord(p), fields)) {
+        Utils::printSuccess("Patient record added successfully!");
+    } else if (connected) {
+        Utils::printError(errorOf(fields));
+    }
+    Utils::pauseScreen();
+}
+
+void RemoteClient::searchPatient() {
+    Utils::printHeader("SEARCH PATIENT");
+
+    cout << "1. Search by ID\n";
+    cout << "2. Search by Name (full or partial, case-insensitive)\n";
+    cout << "3. Advanced query (age, priority, admission date, condition)\n";
+    cout << "4. Most recent admissions\n";
+    cout << "5. Admissions between two dates (with daily counts)\n";
+    int choice = Utils::getIntInput("Enter choice: ", 1, 5);
+
+    // SEARCH answers one record; the others a count, then the records
+    vector<string> fields;
+    size_t firstRecord = 2;
+    if (choice == 1) {
+        request("SEARCH " + Utils::getStringInput("Enter Patient ID: "), fields);
+    } else if (choice == 2) {
+        request("FIND " + Utils::getStringInput("Enter Patient Name: "), fields);
+        firstRecord = 3;
+    } else if (choice == 4) {
+        int n = Utils::getIntInput("How many (1-100): ", 1, static_cast<int>(MAX_RESULT_ROWS));
+        request("RECENT " + to_string(n), fields);
+        firstRecord = 3;
+    } else if (choice == 5) {
+        string range = Utils::getDateInput("From (YYYY-MM-DD): ");
+        range += "," + Utils::getDateInput("To (YYYY-MM-DD): ");
+        if (!request("DAILY " + range, fields)) {
+            if (connected) Utils::printError(errorOf(fields));
+            Utils::pauseScreen();
+            return;
+        }
+        printDailyCounts(fields);
+        request("ADMITTED " + range + "," + to_string(MAX_RESULT_ROWS + 1), fields);
+        firstRecord = 3;
+    } else {
+        // One row past the display limit tells us the result was cut short
+        string spec = PatientQuery::promptSpec();
+        if (!request("QUERY " + spec + (spec.empty() ? "" : ",") + "limit=" + to_string(MAX_RESULT_ROWS + 1), fields)) {
+            if (connected) Utils::printError("Invalid query: " + errorOf(fields));
+            Utils::pauseScreen();
+            return;
+        }
+        firstRecord = 3;
+    }
+
+    vector<Patient> results;
+    if (!fields.empty() && fields[0] == "OK") {
+        for (size_t i = firstRecord; i < fields.size(); i++) {
+            Patient p;
+            if (parsePatient(fields[i], p)) results.push_back(std::move(p));
+        }
+    }
+
+    bool truncated = results.size() > MAX_RESULT_ROWS;
+    if (truncated) results.resize(MAX_RESULT_ROWS);
+
+    if (!results.empty()) {
+        if (results.size() == 1) {
+            Utils::printSuccess("Patient Found!");
+        } else {
+            Utils::printSuccess(to_string(results.size()) + (truncated ? "+" : "") + " patients found!");
+        }
+
+        TableRenderer table;
+        table.setColumns({{"ID", 10}, {"Name", 25}, {"Age", 5}, {"Priority", 10}, {"Date", 15}, {"Condition", 0}});
+        table.reserveRows(results.size());
+        table.text("\n");
+        table.rule('=', 110);
+        table.header();
+        table.rule('-', 110);
+        for (const Patient& p : results) {
+            table.cell(p.id).cell(p.name).cell(p.age).cell(p.priority).cell(p.admissionDate).cell(p.condition);
+            table.endRow();
+        }
+        table.rule('-', 110);
+        table.flush();
+        if (truncated) {
+            cout << "[INFO] Showing the first " << MAX_RESULT_ROWS
+                 << " matches. Narrow the query to see the rest.\n";
+        }
+    } else if (connected) {
+        Utils::printError("Patient not found.");
+    }
+
+    Utils::pauseScreen();
+}
+
+void RemoteClient::deletePatientRecord() {
+    Utils::printHeader("DELETE PATIENT RECORD");
+
+    string id = Utils::getStringInput("Enter Patient ID to delete: ");
+
+    if (Utils::confirmAction("Are you sure you want to delete this patient?")) {
+        vector<string> fields;
+        if (request("DELETE " + id, fields)) {
+            Utils::printSuccess("Patient deleted successfully.");
+        } else if (connected) {
+            Utils::printError("Patient not found.");
+        }
+    }
+
+    Utils::pauseScreen();
+}
+
+// Same keys as the local pager, minus [I]D: pages are fetched by number
+void RemoteClient::browsePages(const string& command, const string& title) {
+    bool queueView = (command == "QUEUE");
+    long long page = 1;
+
+    while (connected) {
+        vector<string> fields;
+        if (!request(command + " " + to_string(page) + "," + to_string(PAGE_SIZE), fields) || fields.size() < 5) {
+            if (connected) Utils::printError(errorOf(fields));
+            Utils::pauseScreen();
+            return;
+        }
+        // OK, command, page, pages, total, records...
+        page = atoll(fields[2].c_str());
+        long long pages = atoll(fields[3].c_str());
+        long long total = atoll(fields[4].c_str());
+
+        Utils::clearScreen();
+        Utils::printHeader(title);
+        if (total == 0) {
+            cout << (queueView ? "Queue is empty.\n" : "No patient records found.\n");
+            Utils::pauseScreen();
+            return;
+        }
+
+        size_t width = queueView ? 95 : 90;
+        TableRenderer table;
+        if (queueView) {
+            table.setColumns({{"Pos", 5}, {"ID", 8}, {"Name", 25}, {"Priority", 10}, {"Condition", 0}});
+        } else {
+            table.setColumns({{"ID", 8}, {"Name", 25}, {"Age", 5}, {"Priority", 10}, {"Condition", 0}});
+        }
+        table.reserveRows(PAGE_SIZE);
+        table.text("\n");
+        table.rule('=', width);
+        table.text(queueView ? "  INTELLIGENT CLINIC QUEUE MANAGEMENT SYSTEM - PATIENT WAITING QUEUE\n"
+                             : "  ALL PATIENT RECORDS\n");
+        table.rule('=', width);
+        table.header();
+        table.rule('-', width);
+
+        long long first = (page - 1) * PAGE_SIZE;
+        long long shown = 0;
+        for (size_t i = 5; i < fields.size(); i++) {
+            Patient p;
+            if (!parsePatient(fields[i], p)) continue;
+            if (queueView) {
+                table.cell(first + shown + 1).cell(p.id).cell(p.name).cell(p.priority).cell(p.condition);
+            } else {
+                table.cell(p.id).cell(p.name).cell(p.age).cell(p.priority).cell(p.condition);
+            }
+            table.endRow();
+            shown++;
+        }
+
+        table.rule('-', width);
+        if (queueView) {
+            table.text("Page " + to_string(page) + " of " + to_string(pages) +
+                       "  (total in queue: " + to_string(total) + ")\n\n");
+        } else {
+            table.text("Page " + to_string(page) + " of " + to_string(pages) +
+                       "  (records " + to_string(first + 1) + "-" + to_string(first + shown) +
+                       " of " + to_string(total) + ")\n\n");
+        }
+        table.flush();
+
+        string key = Utils::getStringInput("[N]ext  [P]rev  [F]irst  [L]ast  [J]ump  [Q]uit: ");
+        switch (key.empty() ? 'N' : toupper(static_cast<unsigned char>(key[0]))) {
+            case 'N': page = min(page + 1, pages); break;
+            case 'P': page = max(page - 1, 1LL); break;
+            case 'F': page = 1; break;
+            case 'L': page = pages; break;      // The server clamps if the list shrank
+            case 'J': page = Utils::getIntInput("Page number: ", 1, INT_MAX); break;
+            case 'Q': return;
+            default: break;
+        }
+    }
+}
+
+void RemoteClient::sortPatients() {
+    Utils::printHeader("SORT PATIENTS");
+
+    cout << "1. Sort by Name\n";
+    cout << "2. Sort by Priority\n";
+    cout << "3. Sort by Priority, then Admission Date, then Name\n";
+    int choice = Utils::getIntInput("Enter choice: ", 1, 3);
+
+    static const char* const KEYS[] = {"NAME", "PRIORITY", "TRIAGE"};
+    static const char* const DONE[] = {"Patients sorted by name.", "Patients sorted by priority.",
+                                       "Patients sorted by priority, admission date and name."};
+    vector<string> fields;
+    if (request(string("SORT ") + KEYS[choice - 1], fields)) {
+        Utils::printSuccess(DONE[choice - 1]);
+    } else if (connected) {
+        Utils::printError(errorOf(fields));
+    }
+
+    Utils::pauseScreen();
+}
+
+void RemoteClient::editPatientRecord() {
+    Utils::printHeader("EDIT PATIENT RECORD");
+
+    string id = Utils::getStringInput("Enter Patient ID to edit: ");
+
+    // Fetch the current record so only the chosen field changes
+    vector<string> fields;
+    Patient currentData;
+    if (!request("SEARCH " + id, fields) || fields.size() < 3 || !parsePatient(fields[2], currentData)) {
+        if (connected) Utils::printError("Patient not found.");
+        Utils::pauseScreen();
+        return;
+    }
+
+    cout << "Editing Patient: " << currentData.name << "\n";
+    cout << "1. Update Condition\n";
+    cout << "2. Update Priority\n";
+    cout << "3. Cancel\n";
+
+    int choice = Utils::getIntInput("Enter choice: ", 1, 3);
+
+    if (choice == 3) return;
+
+    if (choice == 1) {
+        currentData.condition = Utils::getStringInput("Enter new Condition: ");
+    } else {
+        currentData.priority = Utils::getIntInput("Enter new Priority (1-3): ", 1, 3);
+    }
+
+    if (request("UPDATE " + formatRecord(currentData), fields)) {
+        Utils::printSuccess("Patient record updated successfully!");
+    } else if (connected) {
+        Utils::printError(errorOf(fields));
+    }
+    Utils::pauseScreen();
+}
+
+// ============= QUEUE =============
+
+void RemoteClient::addPatientToQueue() {
+    Utils::printHeader("ADD PATIENT TO QUEUE");
+
+    string id = Utils::getStringInput("Enter Patient ID: ");
+
+    vector<string> fields;
+    if (request("WAITING " + id, fields)) {
+        Utils::printError("Patient " + id + " is already waiting in the queue.");
+        Utils::pauseScreen();
+        return;
+    }
+    if (!connected) return;
+
+    Patient p;
+    if (request("SEARCH " + id, fields) && fields.size() >= 3 && parsePatient(fields[2], p)) {
+        // Stored patient: today's reason for visit and triage replace the record's
+        Utils::printSuccess("Record Found: " + p.name + " (Age: " + to_string(p.age) + ")");
+        cout << "----------------------------------------\n";
+
+        p.condition = Utils::getStringInput("Reason for visit (Condition): ");
+        p.priority = Utils::getIntInput("Triage Priority (1=Critical, 2=Urgent, 3=Normal): ", 1, 3);
+        p.admissionDate = Utils::getDateInput("Visit Date (YYYY-MM-DD): ");
+
+        if (request("ENQUEUE " + formatRecord(p), fields)) {
+            Utils::printSuccess("Existing patient " + p.name + " added to queue successfully!");
+        } else if (connected) {
+            Utils::printError(errorOf(fields));
+        }
+    } else if (connected) {
+        Utils::printError("ID not found in permanent records.");
+
+        if (Utils::confirmAction("Register as new walk-in patient?")) {
+            p.id = id;
+            p.name = Utils::getStringInput("Patient Name: ");
+            p.age = Utils::getIntInput("Age: ", 0, 150);
+            p.condition = Utils::getStringInput("Condition: ");
+            p.priority = Utils::getIntInput("Priority (1=Critical, 2=Urgent, 3=Normal): ", 1, 3);
+            p.admissionDate = Utils::getDateInput("Date (YYYY-MM-DD): ");
+
+            if (request("ENQUEUE " + formatRecord(p), fields)) {
+                Utils::printSuccess("Walk-in patient added to queue!");
+                cout << "(Note: Use 'Add Patient Record' in the menu if you want to save them permanently)\n";
+            } else if (connected) {
+                Utils::printError(errorOf(fields));
+            }
+        }
+    }
+
+    Utils::pauseScreen();
+}
+
+void RemoteClient::processNextPatient() {
+    Utils::printHeader("PROCESS NEXT PATIENT");
+
+    vector<string> fields;
+    Patient p;
+    if (request("DEQUEUE", fields) && fields.size() >= 3 && parsePatient(fields[2], p)) {
+        cout << "Now Calling: \n";
+        cout << "--------------------------------\n";
+        cout << "Name:     " << p.name << "\n";
+        cout << "ID:       " << p.id << "\n";
+        cout << "Priority: " << p.priority << "\n";
+        cout << "Condition: " << p.condition << "\n";
+        cout << "--------------------------------\n";
+
+        Utils::printSuccess("Patient processed successfully.");
+    } else if (connected) {
+        Utils::printError("The queue is empty. No patients to serve.");
+    }
+
+    Utils::pauseScreen();
+}
+
+void RemoteClient::retriagePatient() {
+    Utils::printHeader("RE-TRIAGE PATIENT");
+
+    string id = Utils::getStringInput("Enter Patient ID in queue: ");
+
+    vector<string> fields;
+    Patient waiting;
+    if (!request("WAITING " + id, fields) || fields.size() < 3 || !parsePatient(fields[2], waiting)) {
+        if (connected) Utils::printError("Patient is not in the queue.");
+        Utils::pauseScreen();
+        return;
+    }
+
+    cout << "Current Priority for " << waiting.name << ": " << waiting.priority << "\n";
+    int newPriority = Utils::getIntInput("New Priority (1=Critical, 2=Urgent, 3=Normal): ", 1, 3);
+
+    // Someone else may have served the patient in the meantime
+    if (request("RETRIAGE " + id + "," + to_string(newPriority), fields)) {
+        Utils::printSuccess("Patient re-triaged to priority " + to_string(newPriority) + ".");
+    } else if (connected) {
+        Utils::printError("Patient is not in the queue.");
+    }
+    Utils::pauseScreen();
+}
+
+void RemoteClient::removeFromQueue() {
+    Utils::printHeader("REMOVE PATIENT FROM QUEUE");
+
+    string id = Utils::getStringInput("Enter Patient ID to remove: ");
+
+    if (Utils::confirmAction("Remove this patient from the waiting queue?")) {
+        vector<string> fields;
+        if (request("REMOVE " + id, fields)) {
+            Utils::printSuccess("Patient removed from queue.");
+        } else if (connected) {
+            Utils::printError("Patient is not in the queue.");
+        }
+    }
+
+    Utils::pauseScreen();
+}
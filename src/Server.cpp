@@ -0,0 +1,349 @@
+#include "../include/Server.h"
+#include "../include/Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#ifndef _WIN32
+    #include <cerrno>
+    #include <csignal>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+
+static const size_t MAX_REQUEST_BYTES = 1 << 16;   // Longer lines close the connection
+static const int LISTEN_BACKLOG = 64;
+
+Server::Server(LinkedListADT& patientList, QueueADT& queue, const UserManager& userManager)
+    : runner(patientList, queue), users(userManager), shuttingDown(false),
+      listenFd(-1), stopRequested(false) {
+    wakePipe[0] = wakePipe[1] = -1;
+}
+
+void Server::setWriteHooks(const BeforeWrite& before, const AfterWrite& after) {
+    beforeWrite = before;
+    afterWrite = after;
+}
+
+// Doctors get what their menu offers: look up, serve, re-triage, remove
+static bool doctorMayRun(const string& command) {
+    return BatchRunner::isReadOnly(command) || command == "DEQUEUE" ||
+           command == "RETRIAGE" || command == "REMOVE";
+}
+
+string Server::handle(const string& line, Session& session) {
+    size_t space = line.find(' ');
+    string command = line.substr(0, space);
+    transform(command.begin(), command.end(), command.begin(),
+              [](unsigned char c) { return static_cast<char>(toupper(c)); });
+    string args = (space == string::npos) ? "" : line.substr(space + 1);
+
+    if (command.empty()) {
+        return "ERR\t-\tempty request\n";
+    }
+    if (command == "LOGIN") {
+        size_t comma = args.find(',');
+        UserRole role;
+        if (comma == string::npos || !users.authenticate(args.substr(0, comma), args.substr(comma + 1), role)) {
+            session.username.clear();
+            return "ERR\tLOGIN\tinvalid username or password\n";
+        }
+        session.username = args.substr(0, comma);
+        session.role = role;
+        return string("OK\tLOGIN\t") + (role == ADMIN ? "ADMIN" : "DOCTOR") + "\n";
+    }
+    if (command == "LOGOUT") {
+        session.username.clear();
+        return "OK\tLOGOUT\n";
+    }
+    if (command == "QUIT") {
+        session.quit = true;
+        return "OK\tQUIT\n";
+    }
+    if (session.username.empty()) {
+        return "ERR\t" + command + "\tlogin required\n";
+    }
+    if (session.role != ADMIN && !doctorMayRun(command)) {
+        return "ERR\t" + command + "\tnot permitted for doctors\n";
+    }
+
+    string result;
+    if (BatchRunner::isReadOnly(command)) {
+        shared_lock<shared_mutex> lock(dataLock);
+        runner.execute(line, result);
+    } else {
+        unique_lock<shared_mutex> lock(dataLock);
+        if (beforeWrite) beforeWrite(session.username);
+        runner.execute(line, result);
+        if (afterWrite) afterWrite();
+    }
+    return result;
+}
+
+#ifndef _WIN32
+
+Server::~Server() {
+    for (const auto& entry : connections) {
+        close(entry.first);
+    }
+    if (listenFd >= 0) {
+        close(listenFd);
+        unlink(socketPath.c_str());
+    }
+    for (int fd : wakePipe) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+bool Server::listen(const string& path) {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        Utils::printError("Socket path is empty or too long: " + path);
+        return false;
+    }
+    memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    // Replace a socket left behind by a crash, but never a live server or a regular file
+    struct stat info;
+    if (lstat(path.c_str(), &info) == 0) {
+        if (!S_ISSOCK(info.st_mode)) {
+            Utils::printError(path + " exists and is not a socket.");
+            return false;
+        }
+        int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+        bool live = probe >= 0 && connect(probe, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+        if (probe >= 0) close(probe);
+        if (live) {
+            Utils::printError("Another server is already listening on " + path);
+            return false;
+        }
+        unlink(path.c_str());
+    }
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0 || fcntl(listenFd, F_SETFD, FD_CLOEXEC) != 0 ||
+        bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        Utils::printError("Cannot bind " + path + ": " + strerror(errno));
+        if (listenFd >= 0) close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+    socketPath = path;
+    chmod(path.c_str(), 0660);      // Owner and group only
+    if (::listen(listenFd, LISTEN_BACKLOG) != 0 || pipe(wakePipe) != 0) {
+        Utils::printError("Cannot listen on " + path + ": " + strerror(errno));
+        return false;
+    }
+    for (int fd : wakePipe) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);   // stop() must never block
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    signal(SIGPIPE, SIG_IGN);       // A client vanishing mid-reply is an error return, not a kill
+    return true;
+}
+
+void Server::wake() {
+    char signalByte = 1;
+    if (write(wakePipe[1], &signalByte, 1) < 0) {
+        // Pipe full: poll() is already due to wake up
+    }
+}
+
+void Server::stop() {
+    stopRequested.store(true);
+    wake();
+}
+
+// One client per poll() round; the listening socket stays blocking
+void Server::acceptClients() {
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) return;
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    lock_guard<mutex> lock(stateMutex);
+    connections[fd];
+}
+
+bool Server::readFrom(int fd) {
+    char buffer[1 << 16];
+    ssize_t got = read(fd, buffer, sizeof(buffer));
+    if (got < 0) {
+        return errno == EINTR || errno == EAGAIN;
+    }
+    if (got == 0) {
+        return false;
+    }
+
+    lock_guard<mutex> lock(stateMutex);
+    Connection& connection = connections[fd];
+    connection.inbox.append(buffer, static_cast<size_t>(got));
+    return connection.inbox.size() <= MAX_REQUEST_BYTES || connection.inbox.find('\n') != string::npos;
+}
+
+void Server::dispatchReady() {
+    lock_guard<mutex> lock(stateMutex);
+    for (auto& entry : connections) {
+        Connection& connection = entry.second;
+        if (!connection.busy && !connection.closing && connection.inbox.find('\n') != string::npos) {
+            connection.busy = true;
+            jobs.push_back(entry.first);
+            jobReady.notify_one();
+        }
+    }
+}
+
+void Server::closeFinished() {
+    lock_guard<mutex> lock(stateMutex);
+    for (auto it = connections.begin(); it != connections.end();) {
+        if (it->second.closing && !it->second.busy) {
+            close(it->first);
+            it = connections.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+static bool sendAll(int fd, const string& data) {
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, flags);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+void Server::workerLoop() {
+    while (true) {
+        int fd;
+        string line;
+        Session session;
+        {
+            unique_lock<mutex> lock(stateMutex);
+            jobReady.wait(lock, [this] { return shuttingDown || !jobs.empty(); });
+            if (jobs.empty()) return;
+            fd = jobs.front();
+            jobs.pop_front();
+
+            // Connections are only erased when idle, so this one is still here
+            Connection& connection = connections.at(fd);
+            size_t newline = connection.inbox.find('\n');
+            line = connection.inbox.substr(0, newline);
+            connection.inbox.erase(0, newline + 1);
+            session = connection.session;
+        }
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        string response = handle(line, session);
+        bool sent = sendAll(fd, response);
+
+        {
+            lock_guard<mutex> lock(stateMutex);
+            Connection& connection = connections.at(fd);
+            connection.session = session;
+            connection.closing = connection.closing || session.quit || !sent;
+            connection.busy = false;
+        }
+        wake();     // Let poll() watch this connection again
+    }
+}
+
+void Server::run(int workerCount) {
+    for (int i = 0; i < max(1, workerCount); i++) {
+        workers.emplace_back(&Server::workerLoop, this);
+    }
+
+    vector<pollfd> fds;
+    while (!stopRequested.load()) {
+        fds.clear();
+        fds.push_back(pollfd{wakePipe[0], POLLIN, 0});
+        fds.push_back(pollfd{listenFd, POLLIN, 0});
+        {
+            // Busy connections are left alone until their reply is written
+            lock_guard<mutex> lock(stateMutex);
+            for (const auto& entry : connections) {
+                if (!entry.second.busy && !entry.second.closing) {
+                    fds.push_back(pollfd{entry.first, POLLIN, 0});
+                }
+            }
+        }
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            Utils::printError(string("poll failed: ") + strerror(errno));
+            break;
+        }
+        if (fds[0].revents != 0) {
+            char drain[256];
+            while (read(wakePipe[0], drain, sizeof(drain)) > 0) {}
+        }
+        if (fds[1].revents & POLLIN) {
+            acceptClients();
+        }
+        for (size_t i = 2; i < fds.size(); i++) {
+            if (fds[i].revents != 0 && !readFrom(fds[i].fd)) {
+                lock_guard<mutex> lock(stateMutex);
+                connections[fds[i].fd].closing = true;
+            }
+        }
+        closeFinished();
+        dispatchReady();
+    }
+
+    // Let requests already taken finish, then hang up on everyone
+    {
+        lock_guard<mutex> lock(stateMutex);
+        shuttingDown = true;
+        jobs.clear();
+        for (auto& entry : connections) entry.second.closing = true;
+    }
+    jobReady.notify_all();
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+
+    // Queued requests that never ran leave their connection marked busy;
+    // no worker owns anything now, so every connection can be closed
+    {
+        lock_guard<mutex> lock(stateMutex);
+        for (auto& entry : connections) entry.second.busy = false;
+    }
+    closeFinished();
+}
+
+#else   // Unix domain sockets are not available in this build
+
+Server::~Server() {}
+
+bool Server::listen(const string&) {
+    Utils::printError("Server mode needs Unix domain sockets (not supported on this platform).");
+    return false;
+}
+
+void Server::wake() {}
+void Server::stop() { stopRequested.store(true); }
+void Server::acceptClients() {}
+bool Server::readFrom(int) { return false; }
+void Server::dispatchReady() {}
+void Server::closeFinished() {}
+void Server::workerLoop() {}
+void Server::run(int) {}
+
+#endif
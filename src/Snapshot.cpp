@@ -0,0 +1,339 @@
+#include "../include/Snapshot.h"
+#include "../include/Utils.h"
+#include "../include/Stats.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+    #include <fstream>
+    #include <iterator>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace Snapshot {
+
+    static const char MAGIC[8] = {'M', 'E', 'D', 'I', 'F', 'L', 'O', 'W'};
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t kind;
+        uint64_t recordCount;
+        uint64_t payloadBytes;
+        uint64_t checksum;
+        uint64_t journalLsn;    // Added in version 2
+    };
+
+    static const size_t HEADER_V1_SIZE = 40;
+
+    static uint64_t fnv1a(const unsigned char* data, size_t length, uint64_t h = 1469598103934665603ULL) {
+        for (size_t i = 0; i < length; i++) {
+            h ^= data[i];
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    static bool endsWith(const string& text, const string& suffix) {
+        return text.size() >= suffix.size() &&
+               text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    bool isSnapshotFile(const string& filename) {
+        return endsWith(filename, ".snap") || endsWith(filename, ".bin");
+    }
+
+    static void appendBytes(vector<unsigned char>& out, const void* data, size_t length) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        out.insert(out.end(), bytes, bytes + length);
+    }
+
+    bool write(const string& filename, Kind kind, const CompactPatientStore& store, uint64_t journalLsn) {
+        // Build the payload in memory so the checksum is known up front
+        vector<unsigned char> payload;
+        const StringPool& strings = store.rawStrings();
+        const string& arena = store.rawArena();
+        const vector<CompactPatient>& records = store.rawRecords();
+
+        size_t estimate = 4 + 8 + arena.size() + records.size() * sizeof(CompactPatient);
+        for (uint32_t i = 0; i < strings.size(); i++) estimate += 4 + strings.get(i).size();
+        payload.reserve(estimate);
+
+        uint32_t stringCount = strings.size();
+        appendBytes(payload, &stringCount, sizeof(stringCount));
+        for (uint32_t i = 0; i < stringCount; i++) {
+            const string& value = strings.get(i);
+            uint32_t length = static_cast<uint32_t>(value.size());
+            appendBytes(payload, &length, sizeof(length));
+            appendBytes(payload, value.data(), value.size());
+        }
+
+        uint64_t arenaLength = arena.size();
+        appendBytes(payload, &arenaLength, sizeof(arenaLength));
+        appendBytes(payload, arena.data(), arena.size());
+        appendBytes(payload, records.data(), records.size() * sizeof(CompactPatient));
+
+        Header header;
+        memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = FORMAT_VERSION;
+        header.kind = static_cast<uint32_t>(kind);
+        header.recordCount = records.size();
+        header.payloadBytes = payload.size();
+        header.checksum = fnv1a(payload.data(), payload.size());
+        header.journalLsn = journalLsn;
+
+        // Write beside the target, then rename so readers never see a partial file
+        string tempName = filename + ".tmp";
+        FILE* file = fopen(tempName.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                  (payload.empty() || fwrite(payload.data(), payload.size(), 1, file) == 1) &&
+                  fflush(file) == 0;
+        if (ok) Stats::addBytesWritten(sizeof(header) + payload.size());
+#ifndef _WIN32
+        ok = ok && fsync(fileno(file)) == 0;
+#endif
+        ok = (fclose(file) == 0) && ok;
+
+        if (ok) {
+#ifdef _WIN32
+            remove(filename.c_str());   // rename() does not replace on Windows
+#endif
+            ok = rename(tempName.c_str(), filename.c_str()) == 0;
+        }
+        if (!ok) {
+            remove(tempName.c_str());
+        }
+        return ok;
+    }
+
+    // Read-only view of a whole file (mmap where available)
+    class MappedFile {
+    private:
+        const unsigned char* bytes;
+        size_t length;
+#ifdef _WIN32
+        vector<unsigned char> buffer;
+#else
+        void* mapping;
+#endif
+
+    public:
+        MappedFile() : bytes(nullptr), length(0) {
+#ifndef _WIN32
+            mapping = nullptr;
+#endif
+        }
+
+        ~MappedFile() {
+#ifndef _WIN32
+            if (mapping != nullptr) munmap(mapping, length);
+#endif
+        }
+
+        bool open(const string& filename) {
+#ifdef _WIN32
+            ifstream in(filename, ios::binary);
+            if (!in) return false;
+            buffer.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+            bytes = buffer.data();
+            length = buffer.size();
+            return true;
+#else
+            int fd = ::open(filename.c_str(), O_RDONLY);
+            if (fd < 0) return false;
+            struct stat info;
+            if (fstat(fd, &info) != 0) {
+                close(fd);
+                return false;
+            }
+            length = static_cast<size_t>(info.st_size);
+            if (length > 0) {
+                mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping == MAP_FAILED) {
+                    mapping = nullptr;
+                    close(fd);
+                    return false;
+                }
+                madvise(mapping, length, MADV_SEQUENTIAL);
+                bytes = static_cast<const unsigned char*>(mapping);
+            }
+            close(fd);
+            return true;
+#endif
+        }
+
+        const unsigned char* data() const { return bytes; }
+        size_t size() const { return length; }
+    };
+
+    static void corrupt(PatientCsv::LoadReport& report, const string& message) {
+        report.malformed++;
+        report.problems.push_back(message);
+    }
+
+    bool load(const string& filename, Kind kind,
+              const function<bool(const PatientCsv::Record&)>& onRecord,
+              PatientCsv::LoadReport& report,
+              uint64_t* journalLsn) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            return false;
+        }
+
+        const unsigned char* data = file.data();
+        size_t size = file.size();
+        Stats::addBytesRead(size);
+
+        Header header;
+        memset(&header, 0, sizeof(header));
+        if (size < HEADER_V1_SIZE) {
+            corrupt(report, "file too small for a snapshot header");
+            return true;
+        }
+        memcpy(&header, data, HEADER_V1_SIZE);
+
+        if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            corrupt(report, "not a MediFlow snapshot (bad magic)");
+            return true;
+        }
+        if (header.version < 1 || header.version > FORMAT_VERSION) {
+            corrupt(report, "unsupported snapshot version " + to_string(header.version));
+            return true;
+        }
+        size_t headerSize = (header.version == 1) ? HEADER_V1_SIZE : sizeof(header);
+        if (size < headerSize) {
+            corrupt(report, "file too small for a snapshot header");
+            return true;
+        }
+        memcpy(&header, data, headerSize);
+        if (header.kind != static_cast<uint32_t>(kind)) {
+            corrupt(report, "snapshot holds a different kind of data");
+            return true;
+        }
+        if (header.payloadBytes != size - headerSize) {
+            corrupt(report, "truncated snapshot payload");
+            return true;
+        }
+
+        const unsigned char* p = data + headerSize;
+        const unsigned char* end = p + header.payloadBytes;
+        if (fnv1a(p, header.payloadBytes) != header.checksum) {
+            corrupt(report, "snapshot checksum mismatch");
+            return true;
+        }
+
+        // String table: views straight into the mapping
+        uint32_t stringCount;
+        if (end - p < 4) { corrupt(report, "truncated string table"); return true; }
+        memcpy(&stringCount, p, 4);
+        p += 4;
+        vector<string_view> strings;
+        strings.reserve(stringCount);
+        for (uint32_t i = 0; i < stringCount; i++) {
+            uint32_t length;
+            if (end - p < 4) { corrupt(report, "truncated string table"); return true; }
+            memcpy(&length, p, 4);
+            p += 4;
+            if (static_cast<size_t>(end - p) < length) { corrupt(report, "truncated string table"); return true; }
+            strings.emplace_back(reinterpret_cast<const char*>(p), length);
+            p += length;
+        }
+
+        uint64_t arenaLength;
+        if (end - p < 8) { corrupt(report, "truncated name arena"); return true; }
+        memcpy(&arenaLength, p, 8);
+        p += 8;
+        if (static_cast<uint64_t>(end - p) < arenaLength) { corrupt(report, "truncated name arena"); return true; }
+        string_view arena(reinterpret_cast<const char*>(p), arenaLength);
+        p += arenaLength;
+
+        if (static_cast<uint64_t>(end - p) != header.recordCount * sizeof(CompactPatient)) {
+            corrupt(report, "record section size does not match record count");
+            return true;
+        }
+
+        if (journalLsn != nullptr) {
+            *journalLsn = header.journalLsn;
+        }
+
+        // Single pass over the fixed-width records
+        string dateText, problem;
+        for (uint64_t i = 0; i < header.recordCount; i++, p += sizeof(CompactPatient)) {
+            CompactPatient rec;
+            memcpy(&rec, p, sizeof(rec));
+
+            PatientCsv::Record out;
+            out.lineNumber = static_cast<long long>(i) + 1;
+            out.age = rec.age;
+            out.priority = rec.priority;
+
+            bool valid = rec.conditionId < strings.size() &&
+                         static_cast<uint64_t>(rec.nameOffset) + rec.nameLength <= arena.size();
+            if (rec.flags & CompactPatient::FLAG_WIDE_NUMBERS) {
+                // Exact age and priority follow the name
+                uint64_t wideAt = static_cast<uint64_t>(rec.nameOffset) + rec.nameLength;
+                valid = valid && wideAt + 2 * sizeof(int32_t) <= arena.size();
+                if (valid) {
+                    int32_t wide[2];
+                    memcpy(wide, arena.data() + wideAt, sizeof(wide));
+                    out.age = wide[0];
+                    out.priority = wide[1];
+                }
+            }
+            if (rec.flags & CompactPatient::FLAG_LONG_ID) {
+                uint32_t offset, length;
+                memcpy(&offset, rec.id, sizeof(offset));
+                memcpy(&length, rec.id + sizeof(offset), sizeof(length));
+                valid = valid && static_cast<uint64_t>(offset) + length <= arena.size();
+                if (valid) out.id = arena.substr(offset, length);
+            } else {
+                valid = valid && rec.idLength <= sizeof(rec.id);
+                // Inline ID bytes are the first field of the mapped record
+                if (valid) out.id = string_view(reinterpret_cast<const char*>(p), rec.idLength);
+            }
+            if (rec.flags & CompactPatient::FLAG_RAW_DATE) {
+                valid = valid && static_cast<uint32_t>(rec.admissionDay) < strings.size();
+                if (valid) out.admissionDate = strings[static_cast<uint32_t>(rec.admissionDay)];
+            } else {
+                dateText = Utils::formatDate(rec.admissionDay);
+                out.admissionDate = dateText;
+            }
+            if (!valid) {
+                corrupt(report, "record " + to_string(i + 1) + " points outside the string data");
+                continue;
+            }
+
+            out.name = arena.substr(rec.nameOffset, rec.nameLength);
+            out.condition = strings[rec.conditionId];
+
+            // Same field rules as the CSV loader
+            if (!PatientCsv::checkRecord(out, problem)) {
+                report.malformed++;
+                if (report.problems.size() < PatientCsv::MAX_PROBLEMS) {
+                    report.problems.push_back("record " + to_string(i + 1) + ": " + problem);
+                }
+                continue;
+            }
+
+            if (onRecord(out)) {
+                report.loaded++;
+            } else {
+                report.rejected++;
+                if (report.problems.size() < PatientCsv::MAX_PROBLEMS) {
+                    report.problems.push_back("record " + to_string(i + 1) + ": duplicate ID " + string(out.id) + " skipped");
+                }
+            }
+        }
+        return true;
+    }
+}
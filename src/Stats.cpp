@@ -0,0 +1,164 @@
+#include "../include/Stats.h"
+#include "../include/Utils.h"
+#include <algorithm>
+#include <cstdio>
+
+using namespace std;
+
+namespace Stats {
+
+    static const int BUCKETS = 64;      // Bucket b holds [2^(b-1), 2^b) ns; bucket 0 is 0 ns
+
+    static const char* const OP_NAMES[OP_COUNT] = {
+        "list.insert", "list.delete", "list.update", "list.searchByID", "list.searchByName",
+        "list.searchByPrefix", "list.query", "list.admissions", "list.sort", "list.save", "list.load",
+        "queue.enqueue", "queue.dequeue", "queue.retriage", "queue.remove", "queue.save", "queue.load",
+        "user.login", "user.add", "user.delete", "user.save", "user.load"
+    };
+
+    struct Histogram {
+        atomic<uint64_t> count{0};
+        atomic<uint64_t> totalNs{0};
+        atomic<uint64_t> maxNs{0};
+        atomic<uint64_t> buckets[BUCKETS] = {};
+    };
+
+    atomic<bool> enabled{false};
+
+    static Histogram histograms[OP_COUNT];
+    static atomic<uint64_t> bytesRead{0};
+    static atomic<uint64_t> bytesWritten{0};
+
+    // Bit width of ns: 0 -> 0, 1 -> 1, 2..3 -> 2, 4..7 -> 3, ... (durations stay below 2^63)
+    static int bucketOf(uint64_t ns) {
+#if defined(__GNUC__) || defined(__clang__)
+        return ns == 0 ? 0 : 64 - __builtin_clzll(ns);
+#else
+        int bucket = 0;
+        while (ns > 0) {
+            ns >>= 1;
+            bucket++;
+        }
+        return bucket;
+#endif
+    }
+
+    void setEnabled(bool on) {
+        enabled.store(on, memory_order_relaxed);
+    }
+
+    void record(Op op, uint64_t nanoseconds) {
+        Histogram& h = histograms[op];
+        h.count.fetch_add(1, memory_order_relaxed);
+        h.totalNs.fetch_add(nanoseconds, memory_order_relaxed);
+        h.buckets[bucketOf(nanoseconds)].fetch_add(1, memory_order_relaxed);
+
+        uint64_t seen = h.maxNs.load(memory_order_relaxed);
+        while (nanoseconds > seen && !h.maxNs.compare_exchange_weak(seen, nanoseconds, memory_order_relaxed)) {
+        }
+    }
+
+    void addBytesRead(uint64_t bytes) {
+        if (isEnabled()) bytesRead.fetch_add(bytes, memory_order_relaxed);
+    }
+
+    void addBytesWritten(uint64_t bytes) {
+        if (isEnabled()) bytesWritten.fetch_add(bytes, memory_order_relaxed);
+    }
+
+    void reset() {
+        for (Histogram& h : histograms) {
+            h.count.store(0, memory_order_relaxed);
+            h.totalNs.store(0, memory_order_relaxed);
+            h.maxNs.store(0, memory_order_relaxed);
+            for (atomic<uint64_t>& bucket : h.buckets) bucket.store(0, memory_order_relaxed);
+        }
+        bytesRead.store(0, memory_order_relaxed);
+        bytesWritten.store(0, memory_order_relaxed);
+    }
+
+    // Upper bound of the bucket holding the given fraction of samples
+    static uint64_t percentile(const Histogram& h, uint64_t count, double fraction) {
+        uint64_t rank = static_cast<uint64_t>(fraction * static_cast<double>(count));
+        if (rank < 1) rank = 1;
+        uint64_t seen = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            seen += h.buckets[b].load(memory_order_relaxed);
+            if (seen >= rank) {
+                return b == 0 ? 0 : (uint64_t(1) << b) - 1;
+            }
+        }
+        return h.maxNs.load(memory_order_relaxed);
+    }
+
+    static string formatDuration(uint64_t ns) {
+        char text[32];
+        if (ns < 1000) {
+            snprintf(text, sizeof(text), "%llu ns", static_cast<unsigned long long>(ns));
+        } else if (ns < 1000000) {
+            snprintf(text, sizeof(text), "%.1f us", ns / 1e3);
+        } else if (ns < 1000000000) {
+            snprintf(text, sizeof(text), "%.1f ms", ns / 1e6);
+        } else {
+            snprintf(text, sizeof(text), "%.2f s", ns / 1e9);
+        }
+        return text;
+    }
+
+    static string formatBytes(uint64_t bytes) {
+        char text[32];
+        if (bytes < 1024) {
+            snprintf(text, sizeof(text), "%llu B", static_cast<unsigned long long>(bytes));
+        } else if (bytes < 1024 * 1024) {
+            snprintf(text, sizeof(text), "%.1f KiB", bytes / 1024.0);
+        } else {
+            snprintf(text, sizeof(text), "%.1f MiB", bytes / (1024.0 * 1024.0));
+        }
+        return text;
+    }
+
+    string report() {
+        string out;
+        char line[160];
+        snprintf(line, sizeof(line), "%-20s %10s %10s %10s %10s %10s\n",
+                 "Operation", "Count", "Mean", "p50", "p99", "Max");
+        out += line;
+        out += string(75, '-') + "\n";
+
+        int shown = 0;
+        for (int op = 0; op < OP_COUNT; op++) {
+            const Histogram& h = histograms[op];
+            uint64_t count = h.count.load(memory_order_relaxed);
+            if (count == 0) continue;
+            uint64_t maxNs = h.maxNs.load(memory_order_relaxed);
+            // Bucket bounds can overshoot the largest sample; never report past it
+            uint64_t p50 = min(percentile(h, count, 0.50), maxNs);
+            uint64_t p99 = min(percentile(h, count, 0.99), maxNs);
+            snprintf(line, sizeof(line), "%-20s %10llu %10s %10s %10s %10s\n",
+                     OP_NAMES[op], static_cast<unsigned long long>(count),
+                     formatDuration(h.totalNs.load(memory_order_relaxed) / count).c_str(),
+                     formatDuration(p50).c_str(), formatDuration(p99).c_str(),
+                     formatDuration(maxNs).c_str());
+            out += line;
+            shown++;
+        }
+        if (shown == 0) {
+            out += isEnabled() ? "(no operations recorded yet)\n" : "(collection is disabled)\n";
+        }
+
+        out += "\nFile I/O: " + formatBytes(bytesRead.load(memory_order_relaxed)) + " read, " +
+               formatBytes(bytesWritten.load(memory_order_relaxed)) + " written\n";
+        return out;
+    }
+
+    bool dump(const string& filename) {
+        FILE* file = fopen(filename.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        string text = "MediFlow statistics at " + Utils::currentTimestamp() + "\n\n" + report();
+        bool ok = fwrite(text.data(), 1, text.size(), file) == text.size();
+        ok = (fclose(file) == 0) && ok;
+        return ok;
+    }
+}
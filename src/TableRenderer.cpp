@@ -0,0 +1,94 @@
+#include "../include/TableRenderer.h"
+#include <charconv>
+#include <iostream>
+
+using namespace std;
+
+static const char* const COLUMN_SEPARATOR = " | ";
+static const size_t MAX_RECYCLED_BYTES = 16 << 20;   // Don't pin huge buffers forever
+
+// Per-thread spare buffer handed from one renderer to the next
+static string& recycledBuffer() {
+    thread_local string spare;
+    return spare;
+}
+
+TableRenderer::TableRenderer() : currentColumn(0) {
+    buffer.swap(recycledBuffer());
+    buffer.clear();
+}
+
+TableRenderer::~TableRenderer() {
+    flush();
+    if (buffer.capacity() <= MAX_RECYCLED_BYTES) {
+        recycledBuffer().swap(buffer);
+    }
+}
+
+void TableRenderer::reserveRows(size_t rows) {
+    size_t rowWidth = 32;
+    for (const Column& column : columns) {
+        rowWidth += column.width + 3;
+    }
+    buffer.reserve(buffer.size() + rows * rowWidth);
+}
+
+void TableRenderer::setColumns(const vector<Column>& cols) {
+    columns = cols;
+    currentColumn = 0;
+}
+
+void TableRenderer::pad(size_t used, size_t width) {
+    if (used < width) {
+        buffer.append(width - used, ' ');
+    }
+}
+
+void TableRenderer::header() {
+    for (const Column& column : columns) {
+        cell(column.title);
+    }
+    endRow();
+}
+
+void TableRenderer::rule(char c, size_t width) {
+    buffer.append(width, c);
+    buffer += '\n';
+}
+
+void TableRenderer::text(string_view line) {
+    buffer.append(line.data(), line.size());
+}
+
+TableRenderer& TableRenderer::cell(string_view value) {
+    if (currentColumn > 0) {
+        buffer += COLUMN_SEPARATOR;
+    }
+    buffer.append(value.data(), value.size());
+    if (currentColumn + 1 < columns.size()) {
+        pad(value.size(), columns[currentColumn].width);
+    }
+    currentColumn++;
+    return *this;
+}
+
+TableRenderer& TableRenderer::cell(long long value) {
+    char digits[24];
+    to_chars_result result = to_chars(digits, digits + sizeof(digits), value);
+    return cell(string_view(digits, static_cast<size_t>(result.ptr - digits)));
+}
+
+void TableRenderer::endRow() {
+    buffer += '\n';
+    currentColumn = 0;
+}
+
+void TableRenderer::flush() {
+    if (buffer.empty()) {
+        return;
+    }
+    // One write for the whole screen (cout goes straight through to stdio)
+    cout.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+    cout.flush();
+    buffer.clear();
+}
@@ -1,38 +1,51 @@
 #include "../include/UserManager.h"
 #include "../include/Utils.h"
+#include "../include/Stats.h"
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
 
 using namespace std;
 
-UserManager::UserManager() : isLoggedIn(false), userCount(0) {
+UserManager::UserManager() : isLoggedIn(false) {
     initializeDefaultUsers();
 }
 
 void UserManager::initializeDefaultUsers() {
-    // Manually add default users to array
     // Check duplication in case loadFromFile was called first
-    if (userCount == 0) {
+    if (users.empty()) {
         addUser("admin", "admin123", ADMIN);
         addUser("doctor", "doc123", DOCTOR);
     }
 }
 
 bool UserManager::login(const string& username, const string& password) {
-    // Linear Search for matching username and password
-    for (int i = 0; i < userCount; i++) {
-        if (users[i].username == username && users[i].password == password) {
-            currentUser = users[i];
-            isLoggedIn = true;
-            Utils::printSuccess("Login successful! Welcome, " + username);
-            return true;
-        }
+    Stats::Timer timer(Stats::USER_LOGIN);
+    // Hash lookup by username - O(1) average
+    const User* user = users.find(username);
+    if (user != nullptr && user->password == password) {
+        currentUser = *user;
+        isLoggedIn = true;
+        Utils::printSuccess("Login successful! Welcome, " + username);
+        return true;
     }
 
     Utils::printError("Invalid username or password.");
     return false;
 }
 
+bool UserManager::authenticate(const string& username, const string& password, UserRole& role) const {
+    Stats::Timer timer(Stats::USER_LOGIN);
+    const User* user = users.find(username);
+    if (user == nullptr || user->password != password) {
+        return false;
+    }
+    role = user->role;
+    return true;
+}
+
 void UserManager::logout() {
     if (isLoggedIn) {
         cout << "Goodbye, " << currentUser.username << "!\n";
@@ -42,108 +55,105 @@ void UserManager::logout() {
 }
 
 bool UserManager::addUser(const string& username, const string& password, UserRole role) {
-    // 1. Check if array is full
-    if (userCount >= MAX_USERS) {
-        Utils::printError("User limit reached. Cannot add more users.");
+    Stats::Timer timer(Stats::USER_ADD);
+    // insert() rejects an existing username without changing anything
+    if (!users.insert(username, User(username, password, role))) {
+        Utils::printError("Username already exists.");
         return false;
     }
 
-    // 2. Check for duplicate username
-    for (int i = 0; i < userCount; i++) {
-        if (users[i].username == username) {
-            Utils::printError("Username already exists.");
-            return false;
-        }
-    }
-
-    // 3. Add new user to the next available slot
-    users[userCount] = User(username, password, role);
-    userCount++;
-
     Utils::printSuccess("User added successfully.");
     return true;
 }
 
 bool UserManager::deleteUser(const string& username) {
-    int indexToDelete = -1;
-
-    // 1. Find the user index
-    for (int i = 0; i < userCount; i++) {
-        if (users[i].username == username) {
-            indexToDelete = i;
-            break;
-        }
-    }
-
-    if (indexToDelete == -1) {
+    Stats::Timer timer(Stats::USER_DELETE);
+    // O(1) average; the table closes the gap itself, nothing is shifted
+    if (!users.erase(username)) {
         Utils::printError("User not found.");
         return false;
     }
 
-    // 2. Shift all subsequent users one step LEFT to fill the gap
-    for (int i = indexToDelete; i < userCount - 1; i++) {
-        users[i] = users[i + 1];
-    }
-
-    // 3. Decrease count
-    userCount--;
     Utils::printSuccess("User deleted successfully.");
     return true;
 }
 
+vector<const User*> UserManager::sortedUsers() const {
+    vector<const User*> list;
+    list.reserve(users.size());
+    users.forEach([&list](const string&, const User& user) {
+        list.push_back(&user);
+    });
+    sort(list.begin(), list.end(), [](const User* a, const User* b) {
+        return a->username < b->username;
+    });
+    return list;
+}
+
 void UserManager::displayAllUsers() const {
     Utils::printHeader("REGISTERED USERS");
     cout << "Username\t\tRole\n";
     Utils::printSeparator();
 
-    for (int i = 0; i < userCount; i++) {
-        string roleStr = (users[i].role == ADMIN) ? "Admin" : "Doctor";
-        cout << users[i].username << "\t\t\t" << roleStr << "\n";
+    for (const User* user : sortedUsers()) {
+        string roleStr = (user->role == ADMIN) ? "Admin" : "Doctor";
+        cout << user->username << "\t\t\t" << roleStr << "\n";
     }
+    cout << "Total users: " << users.size() << "\n";
 }
 
 void UserManager::saveToFile(const string& filename) const {
+    Stats::Timer timer(Stats::USER_SAVE);
     ofstream file(filename);
     if (!file) {
         Utils::printError("Cannot save users to file.");
         return;
     }
 
-    for (int i = 0; i < userCount; i++) {
-        file << users[i].username << ","
-             << users[i].password << ","
-             << users[i].role << "\n";
+    for (const User* user : sortedUsers()) {
+        file << user->username << ","
+             << user->password << ","
+             << user->role << "\n";
     }
 
+    streamoff written = file.tellp();
+    if (written > 0) Stats::addBytesWritten(static_cast<uint64_t>(written));
     file.close();
 }
 
 void UserManager::loadFromFile(const string& filename) {
-    ifstream file(filename);
+    Stats::Timer timer(Stats::USER_LOAD);
+    ifstream file(filename, ios::binary);
     if (!file) {
         return;
     }
 
-    // Clear current list to avoid duplicates with defaults
-    userCount = 0;
-
-    string username, password;
-    int roleInt;
-
-    while (file.good()) {
-        getline(file, username, ',');
-        if (username.empty()) continue; // Skip empty lines
-
-        getline(file, password, ',');
-        file >> roleInt;
-        file.ignore(); // Skip newline
-
-        // Add directly to array manually to avoid "Already exists" print spam
-        if (userCount < MAX_USERS) {
-            users[userCount] = User(username, password, static_cast<UserRole>(roleInt));
-            userCount++;
-        }
-    }
-    
+    // Bulk load: read the whole file, size the table once, then insert
+    // directly (no per-user messages; a repeated username keeps its first entry)
+    string contents((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
     file.close();
-}
\ No newline at end of file
+    Stats::addBytesRead(contents.size());
+
+    users.clear();
+    users.reserve(static_cast<size_t>(count(contents.begin(), contents.end(), '\n')) + 1);
+
+    size_t lineStart = 0;
+    while (lineStart < contents.size()) {
+        size_t lineEnd = contents.find('\n', lineStart);
+        if (lineEnd == string::npos) lineEnd = contents.size();
+        size_t length = lineEnd - lineStart;
+        if (length > 0 && contents[lineEnd - 1] == '\r') length--;
+        string line = contents.substr(lineStart, length);
+        lineStart = lineEnd + 1;
+
+        // Username,Password,Role
+        size_t first = line.find(',');
+        size_t second = (first == string::npos) ? string::npos : line.find(',', first + 1);
+        if (first == 0 || second == string::npos) continue;   // Empty or malformed line
+
+        string username = line.substr(0, first);
+        string password = line.substr(first + 1, second - first - 1);
+        int roleInt = atoi(line.c_str() + second + 1);
+        users.insert(username, User(username, password, static_cast<UserRole>(roleInt)));
+    }
+}
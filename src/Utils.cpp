@@ -5,9 +5,16 @@
 #include <chrono>
 #include <cerrno>
 #include <cstring>
+#include <cstdio>
+#include <ctime>
+#include <cstdlib>
 
 #ifdef _WIN32
     #include <direct.h>
+    #include <sys/stat.h>
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX            // Keep numeric_limits<>::max() usable
+    #include <windows.h>
 #else
     #include <sys/stat.h>
     #include <sys/types.h>
@@ -18,6 +25,18 @@ using namespace std;
 
 namespace Utils {
 
+#ifdef _WIN32
+    // Windows 10+ consoles understand ANSI sequences once this mode is on
+    static bool enableAnsiConsole() {
+        HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
+        DWORD mode = 0;
+        if (console == INVALID_HANDLE_VALUE || !GetConsoleMode(console, &mode)) {
+            return false;
+        }
+        return SetConsoleMode(console, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING) != 0;
+    }
+#endif
+
     void createDirectoryIfNotExists(const std::string& path) {
         #ifdef _WIN32
             int result = _mkdir(path.c_str());
@@ -33,16 +52,24 @@ namespace Utils {
         }
     }
 
-    void clearScreen() {
-        cout.flush();
+    bool fileExists(const std::string& path) {
+        struct stat info;
+        return stat(path.c_str(), &info) == 0;
+    }
 
+    void clearScreen() {
+        // ANSI: cursor home, clear screen, clear scrollback. No shell, no delay.
         #ifdef _WIN32
-            system("cls");
-        #else
-            system("clear");
+            static bool ansiEnabled = enableAnsiConsole();
+            if (!ansiEnabled) {
+                cout.flush();
+                system("cls");
+                return;
+            }
         #endif
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        static const char CLEAR_SEQUENCE[] = "\033[H\033[2J\033[3J";
+        cout.write(CLEAR_SEQUENCE, sizeof(CLEAR_SEQUENCE) - 1);
+        cout.flush();
     }
 
     void pauseScreen() {
@@ -81,6 +108,20 @@ namespace Utils {
         return value;
     }
 
+    string getDateInput(const string& prompt) {
+        while (true) {
+            string value = getStringInput(prompt);
+            int day;
+            if (parseDate(value, day)) {
+                return value;
+            }
+            cout << "Invalid date. Use YYYY-MM-DD (e.g. 2025-01-31).\n";
+            if (!cin) {
+                return value;   // Input closed: let the caller reject it
+            }
+        }
+    }
+
     bool confirmAction(const string& message) {
         cout << message << " (y/n): ";
         char choice;
@@ -106,4 +147,82 @@ namespace Utils {
     void printSuccess(const string& message) {
         cout << "[SUCCESS] " << message << "\n";
     }
+
+    // Civil date <-> day number conversion (proleptic Gregorian calendar)
+    static int daysFromCivil(int y, int m, int d) {
+        y -= (m <= 2) ? 1 : 0;
+        int era = (y >= 0 ? y : y - 399) / 400;
+        int yoe = y - era * 400;
+        int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+    bool parseDate(const string& text, int& dayNumber) {
+        if (text.size() != 10 || text[4] != '-' || text[7] != '-') {
+            return false;
+        }
+        for (int i = 0; i < 10; i++) {
+            if (i == 4 || i == 7) continue;
+            if (text[i] < '0' || text[i] > '9') return false;
+        }
+
+        int y = (text[0] - '0') * 1000 + (text[1] - '0') * 100 + (text[2] - '0') * 10 + (text[3] - '0');
+        int m = (text[5] - '0') * 10 + (text[6] - '0');
+        int d = (text[8] - '0') * 10 + (text[9] - '0');
+
+        static const int daysInMonth[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        if (m < 1 || m > 12 || d < 1) return false;
+        bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+        int maxDay = daysInMonth[m - 1] + ((m == 2 && leap) ? 1 : 0);
+        if (d > maxDay) return false;
+
+        dayNumber = daysFromCivil(y, m, d);
+        return true;
+    }
+
+    bool parseTimeOfDay(const string& text, int& seconds) {
+        if ((text.size() != 5 && text.size() != 8) || text[2] != ':' || (text.size() == 8 && text[5] != ':')) {
+            return false;
+        }
+        int parts[3] = {0, 0, 0};
+        for (size_t i = 0; i < text.size(); i += 3) {
+            if (text[i] < '0' || text[i] > '9' || text[i + 1] < '0' || text[i + 1] > '9') return false;
+            parts[i / 3] = (text[i] - '0') * 10 + (text[i + 1] - '0');
+        }
+        if (parts[0] > 23 || parts[1] > 59 || parts[2] > 59) return false;
+
+        seconds = parts[0] * 3600 + parts[1] * 60 + parts[2];
+        return true;
+    }
+
+    string formatDate(int dayNumber) {
+        int z = dayNumber + 719468;
+        int era = (z >= 0 ? z : z - 146096) / 146097;
+        int doe = z - era * 146097;
+        int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        int y = yoe + era * 400;
+        int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        int mp = (5 * doy + 2) / 153;
+        int d = doy - (153 * mp + 2) / 5 + 1;
+        int m = mp + (mp < 10 ? 3 : -9);
+        y += (m <= 2) ? 1 : 0;
+
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", y, m, d);
+        return string(buffer);
+    }
+
+    string currentTimestamp() {
+        time_t now = time(nullptr);
+        tm local;
+#ifdef _WIN32
+        localtime_s(&local, &now);
+#else
+        localtime_r(&now, &local);
+#endif
+        char buffer[32];
+        strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &local);
+        return buffer;
+    }
 }
\ No newline at end of file
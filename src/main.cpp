@@ -3,9 +3,26 @@
 #include "../include/Patient.h"
 #include "../include/QueueADT.h"
 #include "../include/LinkedListADT.h"
+#include "../include/PatientQuery.h"
 #include "../include/UserManager.h"
 #include "../include/Utils.h"
+#include "../include/Journal.h"
+#include "../include/Checkpointer.h"
+#include "../include/QueueEventLog.h"
+#include "../include/BatchRunner.h"
+#include "../include/Stats.h"
+#include "../include/Server.h"
+#include "../include/RemoteClient.h"
 #include <iomanip>
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <csignal>
+#include <thread>
 
 using namespace std;
 
@@ -17,6 +34,23 @@ string getDataPath(const string& filename) {
 #include <unistd.h>
 #endif
 
+// Data files: CSV by default, binary snapshots with --format=bin
+string patientsFile = "patients.txt";
+string queueFile = "queue.txt";
+
+// Timestamped history of every queue action (enqueue, served, removed, re-triaged)
+const char* queueLogFile = "queue_log.txt";
+QueueEventLog queueLog;
+
+// Write-ahead journal: every mutation is appended here. The data files
+// above are rewritten by the background checkpointer and on exit.
+const char* journalFile = "journal.log";
+Journal journal;
+Checkpointer checkpointer(journal);
+
+// Operation latencies and I/O totals (admin menu 14), written here on exit
+const char* statsFile = "stats.txt";
+
 // Forward declarations - ADD PARAMETERS HERE
 void showLoginMenu(UserManager& userMgr, QueueADT& queue, LinkedListADT& patientList);
 void showMainMenu(UserManager& userMgr, QueueADT& queue, LinkedListADT& patientList);
@@ -36,11 +70,83 @@ void editPatientRecord(LinkedListADT& patientList);
 void addPatientToQueue(QueueADT& queue, LinkedListADT& patientList);
 void processNextPatient(QueueADT& queue);
 void viewQueue(QueueADT& queue);
+void retriagePatient(QueueADT& queue);
+void removeFromQueue(QueueADT& queue);
+void showQueueHistory();
+void showStatistics();
 
 // User management functions
 void manageUsers(UserManager& userMgr);
 
-int main() {
+// Persistence
+bool checkpoint(QueueADT& queue, LinkedListADT& patientList);
+
+// Non-interactive mode
+int runBatch(const string& commandFile, QueueADT& queue, LinkedListADT& patientList);
+
+// Daemon mode
+int runServer(const string& socketPath, int workerCount, UserManager& userMgr,
+              QueueADT& queue, LinkedListADT& patientList);
+
+int main(int argc, char* argv[]) {
+
+    // Command-line options
+    bool binaryFormat = false;
+    int checkpointSeconds = 60;
+    long long checkpointRecords = 1000;
+    string batchFile;
+    string servePath;
+    string connectPath;
+    int workerCount = max(2, static_cast<int>(thread::hardware_concurrency()));
+    bool collectStats = true;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batchFile = argv[++i];
+        } else if (strncmp(argv[i], "--batch=", 8) == 0 && argv[i][8] != '\0') {
+            batchFile = argv[i] + 8;
+        } else if (strcmp(argv[i], "--format=bin") == 0) {
+            binaryFormat = true;
+        } else if (strcmp(argv[i], "--format=csv") == 0) {
+            binaryFormat = false;
+        } else if (strncmp(argv[i], "--checkpoint-interval=", 22) == 0 && atoi(argv[i] + 22) > 0) {
+            checkpointSeconds = atoi(argv[i] + 22);
+        } else if (strncmp(argv[i], "--checkpoint-records=", 21) == 0 && atoll(argv[i] + 21) > 0) {
+            checkpointRecords = atoll(argv[i] + 21);
+        } else if (strcmp(argv[i], "--no-stats") == 0) {
+            collectStats = false;
+        } else if (strcmp(argv[i], "--serve") == 0 && i + 1 < argc) {
+            servePath = argv[++i];
+        } else if (strncmp(argv[i], "--serve=", 8) == 0 && argv[i][8] != '\0') {
+            servePath = argv[i] + 8;
+        } else if (strncmp(argv[i], "--workers=", 10) == 0 && atoi(argv[i] + 10) > 0) {
+            workerCount = atoi(argv[i] + 10);
+        } else if (strcmp(argv[i], "--connect") == 0 && i + 1 < argc) {
+            connectPath = argv[++i];
+        } else if (strncmp(argv[i], "--connect=", 10) == 0 && argv[i][10] != '\0') {
+            connectPath = argv[i] + 10;
+        } else {
+            cout << "Usage: " << argv[0] << " [--format=csv|bin] [--checkpoint-interval=SECONDS]"
+                 << " [--checkpoint-records=N] [--batch FILE|-] [--no-stats]\n"
+                 << "       " << argv[0] << " --serve SOCKET [--workers=N] [data options]\n"
+                 << "       " << argv[0] << " --connect SOCKET\n";
+            return 1;
+        }
+    }
+    if (!connectPath.empty()) {
+        // Thin client: the server owns the data files
+        RemoteClient client;
+        return client.connect(connectPath) ? client.run() : 1;
+    }
+    if (!batchFile.empty()) {
+        // Batch output is machine-readable results only (see runBatch)
+        ios::sync_with_stdio(false);
+        cout.setstate(ios::badbit);
+    }
+    Stats::setEnabled(collectStats);
+    if (binaryFormat) {
+        patientsFile = "patients.snap";
+        queueFile = "queue.snap";
+    }
 
     // Create data directory
     Utils::createDirectoryIfNotExists("data");
@@ -50,10 +156,59 @@ int main() {
     QueueADT queue;
     LinkedListADT patientList;;
 
+    // Older versions kept the queue contents in queue_log.txt; that name now
+    // belongs to the event log, so move a plain dump to queue.txt first
+    if (!Utils::fileExists("queue.txt") && Utils::fileExists(queueLogFile) &&
+        !QueueEventLog::isEventLog(queueLogFile)) {
+        if (rename(queueLogFile, "queue.txt") == 0) {
+            cout << "[INFO] Moved queue contents from " << queueLogFile << " to queue.txt\n";
+        }
+    }
+
     // Load data from files
     userMgr.loadFromFile("users.txt");
-    patientList.loadFromFile("patients.txt");
-    queue.loadFromFile("queue_log.txt");
+    if (binaryFormat && !Utils::fileExists(patientsFile)) {
+        patientList.loadFromFile("patients.txt");   // First binary run: import the CSV
+    } else {
+        patientList.loadFromFile(patientsFile);
+    }
+    if (binaryFormat && !Utils::fileExists(queueFile)) {
+        queue.loadFromFile("queue.txt");
+    } else {
+        queue.loadFromFile(queueFile);
+    }
+
+    // Replay mutations newer than the snapshots, then start journaling
+    long long replayed = journal.open(journalFile, [&](const Journal::Entry& entry) {
+        if (Journal::isQueueOp(entry.op)) {
+            if (entry.lsn > queue.getSnapshotLsn()) queue.applyJournalEntry(entry);
+        } else {
+            if (entry.lsn > patientList.getSnapshotLsn()) patientList.applyJournalEntry(entry);
+        }
+    }, max(patientList.getSnapshotLsn(), queue.getSnapshotLsn()));
+    if (replayed < 0) {
+        Utils::printError("Cannot open journal: " + string(journalFile) + ". Changes are saved at logout only.");
+    } else if (replayed > 0) {
+        cout << "[INFO] Replayed " << replayed << " journal records from " << journalFile << "\n";
+    }
+    patientList.setJournal(&journal);
+    queue.setJournal(&journal);
+
+    if (queueLog.open(queueLogFile)) {
+        queue.setEventLog(&queueLog);
+    } else {
+        Utils::printError("Cannot open queue event log: " + string(queueLogFile));
+    }
+
+    if (!batchFile.empty()) {
+        return runBatch(batchFile, queue, patientList);
+    }
+
+    checkpointer.configure(checkpointSeconds, checkpointRecords);
+    if (!servePath.empty()) {
+        return runServer(servePath, workerCount, userMgr, queue, patientList);
+    }
+    checkpointer.start(patientsFile, queueFile);
 
     Utils::printHeader("INTELLIGENT CLINIC QUEUE MANAGEMENT SYSTEM");
     cout << "Welcome to the Intelligent Clinic Queue Management System\n";
@@ -65,6 +220,11 @@ int main() {
         } else {
             showMainMenu(userMgr, queue, patientList);
         }
+
+        // Make this action's journal records durable, then let the
+        // checkpointer decide whether to rewrite the data files in the background
+        journal.commit();
+        checkpointer.poll(patientList, queue);
     }
 
     return 0;
@@ -87,6 +247,7 @@ void showLoginMenu(UserManager& userMgr, QueueADT& queue, LinkedListADT& patient
         bool success = userMgr.login(username, password);
 
         if (success) {
+            queueLog.setOperator(username);
             Utils::sleep(3);  //1 second delay after successful login
         } else {
             Utils::pauseScreen();  //Pause on failed login
@@ -95,8 +256,11 @@ void showLoginMenu(UserManager& userMgr, QueueADT& queue, LinkedListADT& patient
         // Save all data before exit
         cout << "\nSaving data...\n";
         userMgr.saveToFile("users.txt");
-        patientList.saveToFile("patients.txt");
-        queue.saveToFile("queue_log.txt");
+        checkpoint(queue, patientList);
+        journal.close();
+        if (Stats::isEnabled() && !Stats::dump(statsFile)) {
+            Utils::printError("Cannot write statistics to " + string(statsFile));
+        }
         cout << "Exiting Intelligent Clinic Queue Management System. Goodbye!\n";
         exit(0);
     }
@@ -124,13 +288,19 @@ void showAdminMenu(UserManager& userMgr, QueueADT& queue, LinkedListADT& patient
     cout << "7.  Add Patient to Queue\n";
     cout << "8.  Process Next Patient\n";
     cout << "9.  View Current Queue\n";
+    cout << "10. Re-triage Patient in Queue\n";
+    cout << "11. Remove Patient from Queue\n";
+    cout << "12. Queue History (Reconstruct at Time)\n";
 
     cout << "\n=== User Management ===\n";
-    cout << "10. Manage Users\n";
-    cout << "\n11. Logout\n";
+    cout << "13. Manage Users\n";
+
+    cout << "\n=== System ===\n";
+    cout << "14. Performance Statistics\n";
+    cout << "\n15. Logout\n";
 
 
-    int choice = Utils::getIntInput("\nEnter choice: ", 1, 11);
+    int choice = Utils::getIntInput("\nEnter choice: ", 1, 15);
 
     switch (choice) {
         case 1: addPatientRecord(patientList); break;
@@ -142,10 +312,13 @@ void showAdminMenu(UserManager& userMgr, QueueADT& queue, LinkedListADT& patient
         case 7: addPatientToQueue(queue, patientList); break;
         case 8: processNextPatient(queue); break;
         case 9: viewQueue(queue); break;
-        case 10: manageUsers(userMgr); break;
-        case 11:
-            patientList.saveToFile("patients.txt");
-            queue.saveToFile("queue_log.txt");
+        case 10: retriagePatient(queue); break;
+        case 11: removeFromQueue(queue); break;
+        case 12: showQueueHistory(); break;
+        case 13: manageUsers(userMgr); break;
+        case 14: showStatistics(); break;
+        case 15:
+            journal.commit();   // Changes are already journaled; no full rewrite
             userMgr.logout();
             break;
     }
@@ -158,24 +331,183 @@ void showDoctorMenu(UserManager& userMgr, QueueADT& queue, LinkedListADT& patien
     cout << "2. Search Patient\n";
     cout << "3. View Current Queue\n";
     cout << "4. Process Next Patient\n";
-    cout << "5. Logout\n";
+    cout << "5. Re-triage Patient in Queue\n";
+    cout << "6. Remove Patient from Queue\n";
+    cout << "7. Logout\n";
 
-    int choice = Utils::getIntInput("\nEnter choice: ", 1, 5);
+    int choice = Utils::getIntInput("\nEnter choice: ", 1, 7);
 
     switch (choice) {
         case 1: displayAllPatients(patientList); break;
         case 2: searchPatient(patientList); break;
         case 3: viewQueue(queue); break;
         case 4: processNextPatient(queue); break;
-        case 5:
-            // Save before logout
-            patientList.saveToFile("patients.txt");
-            queue.saveToFile("queue_log.txt");
+        case 5: retriagePatient(queue); break;
+        case 6: removeFromQueue(queue); break;
+        case 7:
+            journal.commit();   // Changes are already journaled; no full rewrite
             userMgr.logout();
             break;
     }
 }
 
+// ============= PERSISTENCE =============
+
+// Writes both data files and empties the journal they now cover (on exit).
+// If either file fails the journal is kept, so no change is lost.
+bool checkpoint(QueueADT& queue, LinkedListADT& patientList) {
+    checkpointer.stop();
+    journal.commit();
+    bool listSaved = patientList.saveToFile(patientsFile);
+    bool queueSaved = queue.saveToFile(queueFile);
+    if (!listSaved || !queueSaved) {
+        Utils::printError("Save incomplete; changes stay in " + string(journalFile) + " and are replayed on startup.");
+        return false;
+    }
+    if (journal.isOpen() && !journal.truncate()) {
+        Utils::printError("Cannot compact journal: " + string(journalFile));
+    }
+    return true;
+}
+
+// ============= BATCH MODE =============
+
+// Runs a command file ("-" = stdin) without menus, screen clears or pauses.
+// Results go to stdout, one line per command (see BatchRunner.h).
+int runBatch(const string& commandFile, QueueADT& queue, LinkedListADT& patientList) {
+    ifstream file;
+    if (commandFile != "-") {
+        file.open(commandFile);
+        if (!file.is_open()) {
+            cerr << "[ERROR] Cannot open batch file: " << commandFile << "\n";
+            return 1;
+        }
+    }
+    istream& in = (commandFile == "-") ? cin : file;
+    ostream results(cout.rdbuf());   // cout itself stays silenced
+
+    queueLog.setOperator("batch");
+    journal.setGroupCommit(4096, 1000);   // Throughput over per-command latency
+    BatchRunner runner(patientList, queue);
+    runner.setSaveHandler([&]() {
+        return checkpoint(queue, patientList);
+    });
+
+    long long failed = runner.run(in, results);
+    checkpoint(queue, patientList);
+    journal.close();
+    if (Stats::isEnabled() && !Stats::dump(statsFile)) {
+        cerr << "[ERROR] Cannot write statistics to " << statsFile << "\n";
+    }
+    return failed > 0 ? 2 : 0;
+}
+
+// ============= DAEMON MODE =============
+
+// Set while runServer() is serving, so SIGINT/SIGTERM can stop it
+static Server* activeServer = nullptr;
+
+static void stopServer(int) {
+    if (activeServer != nullptr) activeServer->stop();
+}
+
+// Serves the loaded containers to --connect clients until SIGINT/SIGTERM.
+// Every change is journaled and committed before its reply goes out, and
+// the checkpointer keeps rewriting the data files as in interactive mode.
+int runServer(const string& socketPath, int workerCount, UserManager& userMgr,
+              QueueADT& queue, LinkedListADT& patientList) {
+    Server server(patientList, queue, userMgr);
+    if (!server.listen(socketPath)) {
+        journal.close();    // Nothing changed; leave the data files to whoever owns them
+        return 1;
+    }
+
+    checkpointer.start(patientsFile, queueFile);
+    server.setWriteHooks(
+        [](const string& username) { queueLog.setOperator(username); },
+        [&]() {
+            journal.commit();
+            checkpointer.poll(patientList, queue);
+        });
+    server.setSaveHandler([&]() {
+        bool saved = checkpoint(queue, patientList);
+        checkpointer.start(patientsFile, queueFile);
+        return saved;
+    });
+
+    cout << "[INFO] Serving " << patientList.getCount() << " records and " << queue.getSize()
+         << " queued patients on " << socketPath << " with " << workerCount << " workers\n";
+    cout << "[INFO] Connect with --connect=" << socketPath << "; press Ctrl+C to stop.\n";
+    cout.flush();
+
+    // Workers share the containers; their console messages would interleave
+    ios::iostate consoleState = cout.rdstate();
+    cout.setstate(ios::badbit);
+
+    activeServer = &server;
+    signal(SIGINT, stopServer);
+    signal(SIGTERM, stopServer);
+    server.run(workerCount);
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+    activeServer = nullptr;
+
+    cout.clear(consoleState);
+    cout << "\n[INFO] Server stopped. Saving data...\n";
+    checkpoint(queue, patientList);
+    journal.close();
+    if (Stats::isEnabled() && !Stats::dump(statsFile)) {
+        Utils::printError("Cannot write statistics to " + string(statsFile));
+    }
+    return 0;
+}
+
+// ============= PAGED LISTINGS =============
+
+const int PAGE_SIZE = 20;
+
+// Screen-at-a-time browsing for the record list and the queue; each move
+// only walks one page, so large data sets stay responsive
+template <typename Container>
+void browsePages(const Container& container, bool empty, const string& title) {
+    if (empty) {
+        Utils::printHeader(title);
+        container.displayPage(container.firstPage(), PAGE_SIZE);
+        Utils::pauseScreen();
+        return;
+    }
+
+    typename Container::PageCursor page = container.firstPage();
+    while (true) {
+        Utils::clearScreen();
+        Utils::printHeader(title);
+        container.displayPage(page, PAGE_SIZE);
+
+        string command = Utils::getStringInput("[N]ext  [P]rev  [F]irst  [L]ast  [J]ump  [I]D  [Q]uit: ");
+        char key = command.empty() ? 'N' : static_cast<char>(toupper(static_cast<unsigned char>(command[0])));
+
+        switch (key) {
+            case 'N': page = container.nextPage(page, PAGE_SIZE); break;
+            case 'P': page = container.prevPage(page, PAGE_SIZE); break;
+            case 'F': page = container.firstPage(); break;
+            case 'L': page = container.lastPage(PAGE_SIZE); break;
+            case 'J':
+                page = container.jumpToPage(Utils::getIntInput("Page number: ", 1, INT_MAX), PAGE_SIZE);
+                break;
+            case 'I': {
+                string id = Utils::getStringInput("Start from Patient ID: ");
+                if (!container.pageFromID(id, page)) {
+                    Utils::printError("Patient ID " + id + " not found.");
+                    Utils::pauseScreen();
+                }
+                break;
+            }
+            case 'Q': return;
+            default: break;
+        }
+    }
+}
+
 // ============= PATIENT MANAGEMENT FUNCTIONS =============
 
 void addPatientRecord(LinkedListADT& patientList) {
@@ -186,34 +518,84 @@ void addPatientRecord(LinkedListADT& patientList) {
     int age = Utils::getIntInput("Age: ", 0, 150);
     string condition = Utils::getStringInput("Condition: ");
     int priority = Utils::getIntInput("Priority (1=Critical, 2=Urgent, 3=Normal): ", 1, 3);
-    string date = Utils::getStringInput("Admission Date (YYYY-MM-DD): ");
-
-    Patient p(id, name, age, condition, priority, date);
-    patientList.insertPatient(p);
+    string date = Utils::getDateInput("Admission Date (YYYY-MM-DD): ");
 
-    Utils::printSuccess("Patient record added successfully!");
+    if (patientList.emplacePatient(std::move(id), std::move(name), age,
+                                   std::move(condition), priority, std::move(date))) {
+        Utils::printSuccess("Patient record added successfully!");
+    }
     Utils::pauseScreen();
 }
 
+static const size_t MAX_RESULT_ROWS = 100;     // Longer query results are cut short
+
+// Date | Admissions table, then the total
+static void printDailyCounts(const vector<pair<int, size_t>>& days) {
+    size_t total = 0;
+    cout << "\n" << left << setw(12) << "Date" << " | Admissions\n" << string(26, '-') << "\n";
+    for (size_t i = 0; i < days.size(); i++) {
+        total += days[i].second;
+        if (i < MAX_RESULT_ROWS) {
+            cout << left << setw(12) << Utils::formatDate(days[i].first) << " | " << days[i].second << "\n";
+        }
+    }
+    if (days.size() > MAX_RESULT_ROWS) {
+        cout << "... " << (days.size() - MAX_RESULT_ROWS) << " more day(s)\n";
+    }
+    cout << string(26, '-') << "\n" << left << setw(12) << "Total" << " | " << total << "\n";
+}
+
 void searchPatient(LinkedListADT& patientList) {
     Utils::printHeader("SEARCH PATIENT");
 
     cout << "1. Search by ID\n";
-    cout << "2. Search by Name\n";
-    int choice = Utils::getIntInput("Enter choice: ", 1, 2);
+    cout << "2. Search by Name (full or partial, case-insensitive)\n";
+    cout << "3. Advanced query (age, priority, admission date, condition)\n";
+    cout << "4. Most recent admissions\n";
+    cout << "5. Admissions between two dates (with daily counts)\n";
+    int choice = Utils::getIntInput("Enter choice: ", 1, 5);
 
-    Node* result = nullptr;
+    vector<Node*> results;
 
     if (choice == 1) {
         string id = Utils::getStringInput("Enter Patient ID: ");
-        result = patientList.searchByID(id);
-    } else {
+        Node* result = patientList.searchByID(id);
+        if (result) results.push_back(result);
+    } else if (choice == 2) {
         string name = Utils::getStringInput("Enter Patient Name: ");
-        result = patientList.searchByName(name);
+        results = patientList.searchByNamePrefix(name);
+    } else if (choice == 3) {
+        PatientQuery query;
+        string problem;
+        if (!PatientQuery::parse(PatientQuery::promptSpec(), query, problem)) {
+            Utils::printError("Invalid query: " + problem);
+            Utils::pauseScreen();
+            return;
+        }
+        string plan;
+        results = patientList.query(query, &plan);
+        cout << "[INFO] Query plan: " << plan << "\n";
+    } else if (choice == 4) {
+        int n = Utils::getIntInput("How many (1-100): ", 1, static_cast<int>(MAX_RESULT_ROWS));
+        results = patientList.mostRecentAdmissions(static_cast<size_t>(n));
+    } else {
+        int fromDay, toDay;
+        if (!Utils::parseDate(Utils::getDateInput("From (YYYY-MM-DD): "), fromDay) ||
+            !Utils::parseDate(Utils::getDateInput("To (YYYY-MM-DD): "), toDay) || fromDay > toDay) {
+            Utils::printError("Invalid date range ('From' must not be after 'To').");
+            Utils::pauseScreen();
+            return;
+        }
+        printDailyCounts(patientList.dailyAdmissions(fromDay, toDay));
+        results = patientList.admittedBetween(fromDay, toDay);
     }
 
-    if (result) {
-        Utils::printSuccess("Patient Found!");
+    if (!results.empty()) {
+        if (results.size() == 1) {
+            Utils::printSuccess("Patient Found!");
+        } else {
+            Utils::printSuccess(to_string(results.size()) + " patients found!");
+        }
 
         // Table Header
         cout << "\n" << string(110, '=') << "\n";
@@ -226,16 +608,24 @@ void searchPatient(LinkedListADT& patientList) {
              << "Condition\n";
         cout << string(110, '-') << "\n";
 
-        // Patient Data Row
-        cout << left
-             << setw(10) << result->data.id << " | "
-             << setw(25) << result->data.name << " | "
-             << setw(5) << result->data.age << " | "
-             << setw(10) << result->data.priority << " | "
-             << setw(15) << result->data.admissionDate << " | "
-             << result->data.condition << "\n";
+        // Patient Data Rows (long query results are cut short)
+        size_t shown = min(results.size(), MAX_RESULT_ROWS);
+        for (size_t i = 0; i < shown; i++) {
+            Node* result = results[i];
+            cout << left
+                 << setw(10) << result->data.id << " | "
+                 << setw(25) << result->data.name << " | "
+                 << setw(5) << result->data.age << " | "
+                 << setw(10) << result->data.priority << " | "
+                 << setw(15) << result->data.admissionDate << " | "
+                 << result->data.condition << "\n";
+        }
 
         cout << string(110, '-') << "\n";
+        if (shown < results.size()) {
+            cout << "[INFO] Showing the first " << shown << " of " << results.size()
+                 << " matches. Narrow the query to see the rest.\n";
+        }
 
     } else {
         Utils::printError("Patient not found.");
@@ -260,9 +650,7 @@ void deletePatientRecord(LinkedListADT& patientList) {
 }
 
 void displayAllPatients(LinkedListADT& patientList) {
-    Utils::printHeader("ALL PATIENT RECORDS");
-    patientList.displayAll();
-    Utils::pauseScreen();
+    browsePages(patientList, patientList.getCount() == 0, "ALL PATIENT RECORDS");
 }
 
 void sortPatients(LinkedListADT& patientList) {
@@ -270,14 +658,18 @@ void sortPatients(LinkedListADT& patientList) {
 
     cout << "1. Sort by Name\n";
     cout << "2. Sort by Priority\n";
-    int choice = Utils::getIntInput("Enter choice: ", 1, 2);
+    cout << "3. Sort by Priority, then Admission Date, then Name\n";
+    int choice = Utils::getIntInput("Enter choice: ", 1, 3);
 
     if (choice == 1) {
         patientList.sortByName();
         Utils::printSuccess("Patients sorted by name.");
-    } else {
+    } else if (choice == 2) {
         patientList.sortByPriority();
         Utils::printSuccess("Patients sorted by priority.");
+    } else {
+        patientList.sortBy(LinkedListADT::triageOrder);
+        Utils::printSuccess("Patients sorted by priority, admission date and name.");
     }
 
     Utils::pauseScreen();
@@ -290,6 +682,12 @@ void addPatientToQueue(QueueADT& queue, LinkedListADT& patientList) {
 
     string id = Utils::getStringInput("Enter Patient ID: ");
 
+    if (queue.find(id) != nullptr) {
+        Utils::printError("Patient " + id + " is already waiting in the queue.");
+        Utils::pauseScreen();
+        return;
+    }
+
     // Step 1: Search for the ID in the permanent records
     Node* existingRecord = patientList.searchByID(id);
 
@@ -309,11 +707,13 @@ void addPatientToQueue(QueueADT& queue, LinkedListADT& patientList) {
         p.priority = newPriority;
 
         // Optionally update the date to today
-        p.admissionDate = Utils::getStringInput("Visit Date (YYYY-MM-DD): ");
+        p.admissionDate = Utils::getDateInput("Visit Date (YYYY-MM-DD): ");
 
         // Add to queue
-        queue.enqueue(p);
-        Utils::printSuccess("Existing patient " + p.name + " added to queue successfully!");
+        string name = p.name;
+        if (queue.enqueue(std::move(p))) {
+            Utils::printSuccess("Existing patient " + name + " added to queue successfully!");
+        }
 
     } else {
         // === CASE 2: PATIENT NOT FOUND (MANUAL ENTRY) ===
@@ -324,14 +724,13 @@ void addPatientToQueue(QueueADT& queue, LinkedListADT& patientList) {
             int age = Utils::getIntInput("Age: ", 0, 150);
             string condition = Utils::getStringInput("Condition: ");
             int priority = Utils::getIntInput("Priority (1=Critical, 2=Urgent, 3=Normal): ", 1, 3);
-            string date = Utils::getStringInput("Date: ");
+            string date = Utils::getDateInput("Date (YYYY-MM-DD): ");
 
             // Create patient and add to queue ONLY (not saving to permanent list unless you want to)
-            Patient p(id, name, age, condition, priority, date);
-            queue.enqueue(p);
-
-            Utils::printSuccess("Walk-in patient added to queue!");
-            cout << "(Note: Use 'Add Patient Record' in the menu if you want to save them permanently)\n";
+            if (queue.emplace(id, std::move(name), age, std::move(condition), priority, std::move(date))) {
+                Utils::printSuccess("Walk-in patient added to queue!");
+                cout << "(Note: Use 'Add Patient Record' in the menu if you want to save them permanently)\n";
+            }
         }
     }
 
@@ -339,11 +738,100 @@ void addPatientToQueue(QueueADT& queue, LinkedListADT& patientList) {
 }
 
 void viewQueue(QueueADT& queue) {
-    Utils::printHeader("CURRENT QUEUE");
-    queue.display();
+    browsePages(queue, queue.isEmpty(), "CURRENT QUEUE");
+}
+
+void retriagePatient(QueueADT& queue) {
+    Utils::printHeader("RE-TRIAGE PATIENT");
+
+    string id = Utils::getStringInput("Enter Patient ID in queue: ");
+    const Patient* waiting = queue.find(id);
+
+    if (waiting == nullptr) {
+        Utils::printError("Patient is not in the queue.");
+        Utils::pauseScreen();
+        return;
+    }
+
+    cout << "Current Priority for " << waiting->name << ": " << waiting->priority << "\n";
+    int newPriority = Utils::getIntInput("New Priority (1=Critical, 2=Urgent, 3=Normal): ", 1, 3);
+
+    // Patient keeps their original arrival order within the new priority
+    queue.retriage(id, newPriority);
+    Utils::printSuccess("Patient re-triaged to priority " + to_string(newPriority) + ".");
     Utils::pauseScreen();
 }
 
+void removeFromQueue(QueueADT& queue) {
+    Utils::printHeader("REMOVE PATIENT FROM QUEUE");
+
+    string id = Utils::getStringInput("Enter Patient ID to remove: ");
+
+    if (Utils::confirmAction("Remove this patient from the waiting queue?")) {
+        if (queue.remove(id)) {
+            Utils::printSuccess("Patient removed from queue.");
+        } else {
+            Utils::printError("Patient is not in the queue.");
+        }
+    }
+
+    Utils::pauseScreen();
+}
+
+void showQueueHistory() {
+    Utils::printHeader("QUEUE HISTORY");
+
+    string date = Utils::getStringInput("Date (YYYY-MM-DD): ");
+    int day;
+    if (!Utils::parseDate(date, day)) {
+        Utils::printError("Invalid date. Use YYYY-MM-DD.");
+        Utils::pauseScreen();
+        return;
+    }
+    string timeOfDay = Utils::getStringInput("Time (HH:MM, or 'end' for end of day): ");
+    string until = date;
+    if (timeOfDay != "end") {
+        int seconds;
+        if (timeOfDay.size() != 5 || !Utils::parseTimeOfDay(timeOfDay, seconds)) {
+            Utils::printError("Invalid time. Use HH:MM (00:00-23:59).");
+            Utils::pauseScreen();
+            return;
+        }
+        until += " " + timeOfDay;
+    }
+
+    // Rebuild a separate queue from the event log; the live queue is untouched
+    QueueADT snapshot;
+    long long skipped = 0;
+    long long events = QueueEventLog::replay(queueLogFile, until, snapshot, &skipped);
+    if (events < 0) {
+        Utils::printError("Cannot read queue event log: " + string(queueLogFile));
+    } else {
+        cout << "[INFO] Replayed " << events << " queue events up to " << until << "\n";
+        if (skipped > 0) {
+            cout << "[WARNING] Skipped " << skipped << " malformed line(s) in " << queueLogFile << "\n";
+        }
+        snapshot.display();
+    }
+    Utils::pauseScreen();
+}
+
+void showStatistics() {
+    Utils::printHeader("PERFORMANCE STATISTICS");
+
+    cout << Stats::report();
+    cout << "\n[INFO] Percentiles are bucket upper bounds (within 2x). Written to "
+         << statsFile << " on exit.\n";
+
+    cout << "\n1. Reset Counters\n";
+    cout << "2. Back to Main Menu\n";
+    if (Utils::getIntInput("Enter choice: ", 1, 2) == 1) {
+        Stats::reset();
+        Utils::printSuccess("Statistics reset.");
+        Utils::pauseScreen();
+    }
+}
+
 // ============= USER MANAGEMENT FUNCTIONS =============
 
 void manageUsers(UserManager& userMgr) {
@@ -436,7 +924,7 @@ void editPatientRecord(LinkedListADT& patientList) {
     }
 
     // 3. Save the updated object back to the list
-    patientList.updatePatient(id, currentData);
+    patientList.updatePatient(id, std::move(currentData));
 
     Utils::printSuccess("Patient record updated successfully!");
     Utils::pauseScreen();
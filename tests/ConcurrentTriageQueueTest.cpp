@@ -0,0 +1,166 @@
+// mediflow_triage_test - concurrency tests for ConcurrentTriageQueue
+//
+// Usage: mediflow_triage_test [--threads=N]     (default 16)
+//
+// Runs at 2, 4, ... --threads threads: every patient is dequeued exactly
+// once, FIFO within a priority per producer, priorities respected when a
+// full queue is drained, and a dequeue never reports empty while a finished
+// enqueue is still waiting. Registered with CTest; exits with status 1 on
+// the first violation.
+
+#include "../include/ConcurrentTriageQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Runs body(0..threads-1) on its own threads and waits for all of them
+static void runThreads(int threads, const function<void(int)>& body) {
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) pool.emplace_back(body, t);
+    for (thread& worker : pool) worker.join();
+}
+
+// Stress patients carry their producer in age and their sequence number in id
+static Patient makeTagged(int producer, int index) {
+    return Patient(to_string(index), "Stress Test", producer, "Load", 1 + (index * 7 + producer) % 3, "2025-01-01");
+}
+
+// Producers and consumers at once, through a small ring so it wraps and
+// fills up: every patient must come out exactly once, and each producer's
+// patients of one priority in the order they went in. Then a prefilled
+// queue is drained concurrently: each consumer must see priorities in
+// non-decreasing order. Returns false (with a message) on a violation.
+static bool stressTest(int threads, int total) {
+    int producers = max(1, threads / 2);
+    int consumers = max(1, threads - producers);
+    int perProducer = total / producers;
+    total = perProducer * producers;
+
+    unique_ptr<atomic<int>[]> seen(new atomic<int>[total]);
+    for (int i = 0; i < total; i++) seen[i].store(0);
+    atomic<int> taken(0);
+    atomic<bool> failed(false);
+    string problem;
+    mutex problemMutex;
+    auto fail = [&](const string& message) {
+        lock_guard<mutex> lock(problemMutex);
+        if (!failed.exchange(true)) problem = message;
+    };
+
+    ConcurrentTriageQueue mixed(64);
+    runThreads(producers + consumers, [&](int t) {
+        if (t < producers) {
+            for (int i = 0; i < perProducer && !failed.load(); i++) {
+                Patient p = makeTagged(t, i);
+                while (!mixed.enqueue(p) && !failed.load()) this_thread::yield();   // Ring full: let consumers catch up
+            }
+            return;
+        }
+        vector<int> last(static_cast<size_t>(producers) * 3, -1);   // Per producer and priority
+        Patient p;
+        while (taken.load() < total && !failed.load()) {
+            if (!mixed.tryDequeue(p)) {
+                this_thread::yield();
+                continue;
+            }
+            taken++;
+            int index = atoi(p.id.c_str());
+            if (seen[p.age * perProducer + index].fetch_add(1) != 0) {
+                fail("patient " + to_string(p.age) + ":" + p.id + " dequeued twice");
+            }
+            int& previous = last[static_cast<size_t>(p.age) * 3 + p.priority - 1];
+            if (index <= previous) {
+                fail("producer " + to_string(p.age) + " priority " + to_string(p.priority) + " out of order");
+            }
+            previous = index;
+        }
+    });
+    for (int i = 0; i < total && !failed.load(); i++) {
+        if (seen[i].load() != 1) fail("patient " + to_string(i / perProducer) + ":" +
+                                      to_string(i % perProducer) + " never dequeued");
+    }
+
+    ConcurrentTriageQueue prefilled(static_cast<size_t>(total));
+    for (int i = 0; i < total; i++) prefilled.enqueue(makeTagged(0, i));
+    atomic<int> drained(0);
+    runThreads(consumers, [&](int) {
+        int lastPriority = 1;
+        Patient p;
+        while (prefilled.tryDequeue(p)) {
+            drained++;
+            if (p.priority < lastPriority) fail("priority " + to_string(p.priority) + " served after " +
+                                                to_string(lastPriority));
+            lastPriority = p.priority;
+        }
+    });
+    if (drained.load() != total) fail(to_string(drained.load()) + " of " + to_string(total) + " drained");
+
+    if (failed.load()) {
+        cerr << "[ERROR] Stress test with " << threads << " threads failed: " << problem << "\n";
+    }
+    return !failed.load();
+}
+
+// Several producers, one consumer: once the consumer has seen an enqueue
+// finish, tryDequeue must not report empty until it has taken that patient,
+// even while another producer holds an earlier slot it has not filled yet
+static bool noFalseEmpty(int producers, int perProducer) {
+    ConcurrentTriageQueue queue(static_cast<size_t>(producers) * perProducer);
+    atomic<int> finished(0);
+    int taken = 0;
+    bool ok = true;
+
+    runThreads(producers + 1, [&](int t) {
+        if (t < producers) {
+            for (int i = 0; i < perProducer; i++) {
+                queue.enqueue(makeTagged(t, i));
+                finished.fetch_add(1, memory_order_release);
+            }
+            return;
+        }
+        int total = producers * perProducer;
+        Patient p;
+        while (taken < total && ok) {
+            int ready = finished.load(memory_order_acquire);
+            if (queue.tryDequeue(p)) {
+                taken++;
+            } else if (taken < ready) {
+                cerr << "[ERROR] tryDequeue reported empty with " << (ready - taken)
+                     << " finished enqueue(s) waiting (" << producers << " producers)\n";
+                ok = false;
+            }
+        }
+    });
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = 16;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg.compare(0, 10, "--threads=") == 0 && atoi(arg.c_str() + 10) >= 2) {
+            maxThreads = atoi(arg.c_str() + 10);
+        } else {
+            cerr << "Usage: " << argv[0] << " [--threads=N]   (N >= 2)\n";
+            return 1;
+        }
+    }
+
+    for (int threads = 2; threads <= maxThreads; threads *= 2) {
+        cerr << "[INFO] Running " << threads << " threads...\n";
+        if (!stressTest(threads, 200000) || !noFalseEmpty(max(1, threads - 1), 50000)) {
+            return 1;
+        }
+    }
+    cerr << "[SUCCESS] ConcurrentTriageQueue passed at up to " << maxThreads << " threads.\n";
+    return 0;
+}
@@ -0,0 +1,346 @@
+// mediflow_gen - synthetic data for capacity planning
+//
+// Usage: mediflow_gen [--patients=N] [--queue=N] [--users=N] [--seed=N] [--out=DIR]
+//                     [--from=YYYY-MM-DD] [--to=YYYY-MM-DD] [--priority-mix=C,U,N] [--zipf=S]
+//
+// Writes DIR/patients.txt, DIR/queue.txt and DIR/users.txt in the formats the
+// application loads. Records are numbered in admission order across the date
+// range; conditions follow a Zipf distribution (a few conditions dominate),
+// names are drawn from frequency-ranked first/last name lists, and priorities
+// follow the given Critical,Urgent,Normal percentages. The queue holds the
+// most recent admissions in service order. The same seed always produces the
+// same files, on every platform (no std:: distributions are used).
+
+#include "../include/Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const size_t WRITE_BUFFER_BYTES = 1 << 20;   // 1 MiB writes
+
+// Ordered most to least common; sampled with Zipf weights
+static const char* const CONDITIONS[] = {
+    "Flu", "Fever", "Checkup", "Back Pain", "Migraine", "Laceration", "Asthma", "Diabetes",
+    "Hypertension", "Gastroenteritis", "Sprain", "Fracture", "Pneumonia", "Chest Pain",
+    "Allergic Reaction", "Urinary Infection", "Dehydration", "Burns", "Kidney Stones",
+    "Appendicitis", "Concussion", "Heart Disease", "Seizure", "Stroke", "Sepsis",
+    "Heart Attack", "Cardiac Arrest", "Anaphylaxis", "Major Trauma", "Meningitis"
+};
+
+static const char* const FIRST_NAMES[] = {
+    "Muhammad", "Nur", "Ahmad", "Siti", "Wei", "Aisha", "Mei", "Ali", "Sarah", "Daniel",
+    "Priya", "Raj", "Hana", "Omar", "Jia", "Amir", "Fatimah", "Chen", "Maria", "Kumar",
+    "Adam", "Emily", "James", "Li", "Aziz", "Nadia", "Arjun", "Grace", "Hafiz", "Sofia",
+    "Ivan", "Zara", "Kevin", "Lina", "Farid", "Anna", "Imran", "Yasmin", "Ethan", "Mira"
+};
+
+static const char* const LAST_NAMES[] = {
+    "Tan", "Lim", "Abdullah", "Lee", "Wong", "Rahman", "Ng", "Ibrahim", "Chong", "Singh",
+    "Hassan", "Ong", "Goh", "Kumar", "Yusof", "Teo", "Ismail", "Chan", "Ahmad", "Low",
+    "Othman", "Smith", "Menon", "Nair", "Fernandez", "Bakar", "Zain", "Das", "Johnson", "Wan",
+    "Karim", "Pillai", "Ho", "Brown", "Salleh", "Yeoh", "Rao", "Aziz", "Khoo", "Martin"
+};
+
+static const char* const PASSWORD_CHARS =
+    "ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz23456789";
+
+// splitmix64: tiny, fast and identical everywhere
+class Random {
+private:
+    uint64_t state;
+
+public:
+    explicit Random(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    double uniform() { return (next() >> 11) * (1.0 / 9007199254740992.0); }   // [0, 1)
+    uint64_t below(uint64_t bound) { return next() % bound; }
+};
+
+// Cumulative weights over a fixed list; pick() is a binary search
+class WeightedTable {
+private:
+    vector<double> cumulative;
+
+public:
+    void add(double weight) {
+        cumulative.push_back((cumulative.empty() ? 0.0 : cumulative.back()) + weight);
+    }
+
+    void zipf(size_t count, double exponent) {
+        for (size_t rank = 1; rank <= count; rank++) {
+            add(1.0 / pow(static_cast<double>(rank), exponent));
+        }
+    }
+
+    size_t pick(Random& rng) const {
+        double target = rng.uniform() * cumulative.back();
+        size_t index = upper_bound(cumulative.begin(), cumulative.end(), target) - cumulative.begin();
+        return min(index, cumulative.size() - 1);
+    }
+};
+
+// Buffered FILE* writer with the few formatting helpers the rows need
+class Writer {
+private:
+    FILE* file;
+    string buffer;
+
+public:
+    Writer() : file(nullptr) { buffer.reserve(WRITE_BUFFER_BYTES + 256); }
+    ~Writer() { close(); }
+
+    bool open(const string& filename) {
+        file = fopen(filename.c_str(), "wb");
+        return file != nullptr;
+    }
+
+    bool close() {
+        if (file == nullptr) return true;
+        flush();
+        bool ok = !ferror(file);
+        ok = (fclose(file) == 0) && ok;
+        file = nullptr;
+        return ok;
+    }
+
+    void flush() {
+        fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+
+    void endLine() {
+        buffer += '\n';
+        if (buffer.size() >= WRITE_BUFFER_BYTES) flush();
+    }
+
+    Writer& operator<<(const char* text) { buffer += text; return *this; }
+    Writer& operator<<(const string& text) { buffer += text; return *this; }
+    Writer& operator<<(char c) { buffer += c; return *this; }
+
+    // Decimal with leading zeros up to width
+    static void appendNumber(string& out, uint64_t value, int width) {
+        char digits[24];
+        int n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        while (n < width) digits[n++] = '0';
+        while (n > 0) out += digits[--n];
+    }
+};
+
+static bool parseCount(const string& arg, const string& prefix, long long& value) {
+    if (arg.compare(0, prefix.size(), prefix) != 0) return false;
+    value = static_cast<long long>(strtod(arg.c_str() + prefix.size(), nullptr));   // Accepts 1e7
+    return true;
+}
+
+struct Options {
+    long long patients = 1000;
+    long long queue = -1;               // Default: 1% of patients
+    long long users = 20;
+    long long seed = 1;
+    string outDir = ".";
+    string from = "2024-01-01";
+    string to = "2025-12-31";
+    double mix[3] = {10, 30, 60};       // Critical, Urgent, Normal (%)
+    double zipf = 1.1;
+};
+
+static void usage(const char* program) {
+    cerr << "Usage: " << program << " [--patients=N] [--queue=N] [--users=N] [--seed=N] [--out=DIR]\n"
+         << "       [--from=YYYY-MM-DD] [--to=YYYY-MM-DD] [--priority-mix=C,U,N] [--zipf=S]\n";
+}
+
+static bool parseOptions(int argc, char* argv[], Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (parseCount(arg, "--patients=", opt.patients) || parseCount(arg, "--queue=", opt.queue) ||
+            parseCount(arg, "--users=", opt.users) || parseCount(arg, "--seed=", opt.seed)) {
+            continue;
+        }
+        if (arg.compare(0, 6, "--out=") == 0) {
+            opt.outDir = arg.substr(6);
+        } else if (arg.compare(0, 7, "--from=") == 0) {
+            opt.from = arg.substr(7);
+        } else if (arg.compare(0, 5, "--to=") == 0) {
+            opt.to = arg.substr(5);
+        } else if (arg.compare(0, 7, "--zipf=") == 0) {
+            opt.zipf = strtod(arg.c_str() + 7, nullptr);
+        } else if (arg.compare(0, 15, "--priority-mix=") == 0) {
+            if (sscanf(arg.c_str() + 15, "%lf,%lf,%lf", &opt.mix[0], &opt.mix[1], &opt.mix[2]) != 3) {
+                cerr << "[ERROR] --priority-mix expects three numbers, e.g. 10,30,60\n";
+                return false;
+            }
+        } else {
+            usage(argv[0]);
+            return false;
+        }
+    }
+
+    if (opt.queue < 0) opt.queue = opt.patients / 100;
+    if (opt.patients < 0 || opt.users < 0 || opt.queue > opt.patients) {
+        cerr << "[ERROR] Need --patients >= 0, --users >= 0 and --queue <= --patients.\n";
+        return false;
+    }
+    if (opt.mix[0] < 0 || opt.mix[1] < 0 || opt.mix[2] < 0 || opt.mix[0] + opt.mix[1] + opt.mix[2] <= 0) {
+        cerr << "[ERROR] --priority-mix weights must be non-negative and not all zero.\n";
+        return false;
+    }
+    if (opt.zipf < 0) {
+        cerr << "[ERROR] --zipf must be >= 0 (0 = uniform).\n";
+        return false;
+    }
+    return true;
+}
+
+// patients.txt, plus the last opt.queue rows bucketed by priority for queue.txt
+static bool writePatients(const Options& opt, Random& rng, string queueRows[3]) {
+    int firstDay, lastDay;
+    if (!Utils::parseDate(opt.from, firstDay) || !Utils::parseDate(opt.to, lastDay) || lastDay < firstDay) {
+        cerr << "[ERROR] Invalid date range " << opt.from << " .. " << opt.to << "\n";
+        return false;
+    }
+    vector<string> dates;
+    for (int day = firstDay; day <= lastDay; day++) {
+        dates.push_back(Utils::formatDate(day));
+    }
+
+    WeightedTable conditions, firstNames, lastNames, priorities;
+    conditions.zipf(sizeof(CONDITIONS) / sizeof(CONDITIONS[0]), opt.zipf);
+    firstNames.zipf(sizeof(FIRST_NAMES) / sizeof(FIRST_NAMES[0]), 1.0);
+    lastNames.zipf(sizeof(LAST_NAMES) / sizeof(LAST_NAMES[0]), 1.0);
+    for (double weight : opt.mix) priorities.add(weight);
+
+    int idWidth = max(3, static_cast<int>(to_string(opt.patients).size()));
+    long long queueStart = opt.patients - opt.queue;
+
+    Writer out;
+    string filename = opt.outDir + "/patients.txt";
+    if (!out.open(filename)) {
+        cerr << "[ERROR] Cannot open " << filename << " for writing.\n";
+        return false;
+    }
+
+    string row;
+    for (long long i = 0; i < opt.patients; i++) {
+        // Admission dates advance with the ID, so the file is in arrival order
+        size_t day = static_cast<size_t>(i * static_cast<long long>(dates.size()) / opt.patients);
+
+        // Age: 15% children, 55% adults, 30% seniors
+        uint64_t band = rng.below(100);
+        uint64_t age = band < 15 ? rng.below(18) : band < 70 ? 18 + rng.below(47) : 65 + rng.below(31);
+        size_t priority = priorities.pick(rng) + 1;
+
+        row.clear();
+        row += 'P';
+        Writer::appendNumber(row, static_cast<uint64_t>(i + 1), idWidth);
+        row += ',';
+        row += FIRST_NAMES[firstNames.pick(rng)];
+        row += ' ';
+        row += LAST_NAMES[lastNames.pick(rng)];
+        row += ',';
+        Writer::appendNumber(row, age, 1);
+        row += ',';
+        row += CONDITIONS[conditions.pick(rng)];
+        row += ',';
+        row += static_cast<char>('0' + priority);
+        row += ',';
+        row += dates[day];
+
+        out << row;
+        out.endLine();
+        if (i >= queueStart) {
+            queueRows[priority - 1] += row;
+            queueRows[priority - 1] += '\n';
+        }
+    }
+
+    if (!out.close()) {
+        cerr << "[ERROR] Write to " << filename << " failed.\n";
+        return false;
+    }
+    return true;
+}
+
+// Service order: Critical, then Urgent, then Normal, arrivals in order within each
+static bool writeQueue(const Options& opt, const string queueRows[3]) {
+    Writer out;
+    string filename = opt.outDir + "/queue.txt";
+    if (!out.open(filename)) {
+        cerr << "[ERROR] Cannot open " << filename << " for writing.\n";
+        return false;
+    }
+    for (int level = 0; level < 3; level++) {
+        out << queueRows[level];
+    }
+    return out.close();
+}
+
+// The two default accounts, then staff with random passwords (one admin per ten)
+static bool writeUsers(const Options& opt, Random& rng) {
+    Writer out;
+    string filename = opt.outDir + "/users.txt";
+    if (!out.open(filename)) {
+        cerr << "[ERROR] Cannot open " << filename << " for writing.\n";
+        return false;
+    }
+
+    out << "admin,admin123,0";
+    out.endLine();
+    out << "doctor,doc123,1";
+    out.endLine();
+
+    size_t passwordChars = string(PASSWORD_CHARS).size();
+    for (long long i = 1; i <= opt.users; i++) {
+        string username = LAST_NAMES[rng.below(sizeof(LAST_NAMES) / sizeof(LAST_NAMES[0]))];
+        transform(username.begin(), username.end(), username.begin(),
+                  [](unsigned char c) { return static_cast<char>(tolower(c)); });
+        username += to_string(i);       // Unique by construction
+
+        string password;
+        for (int c = 0; c < 10; c++) {
+            password += PASSWORD_CHARS[rng.below(passwordChars)];
+        }
+        out << username << ',' << password << ',' << (i % 10 == 0 ? "0" : "1");
+        out.endLine();
+    }
+    return out.close();
+}
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        return 1;
+    }
+
+    // Independent streams, so changing --users does not change the patients
+    Random patientRng(static_cast<uint64_t>(opt.seed));
+    Random userRng(static_cast<uint64_t>(opt.seed) ^ 0x5DEECE66DULL);
+
+    string queueRows[3];
+    if (!writePatients(opt, patientRng, queueRows) || !writeQueue(opt, queueRows) ||
+        !writeUsers(opt, userRng)) {
+        return 1;
+    }
+
+    cout << "[INFO] Wrote " << opt.patients << " patients, " << opt.queue << " queued and "
+         << opt.users + 2 << " users to " << opt.outDir << " (seed " << opt.seed << ")\n";
+    return 0;
+}